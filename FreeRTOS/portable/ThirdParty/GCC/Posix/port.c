@@ -34,12 +34,28 @@
 * running are blocked in sigwait().
 *
 * Task switch is done by resuming the thread for the next task by
-* signaling the condition variable and then waiting on a condition variable
-* with the current thread.
+* signaling its event and then waiting on the event of the current
+* thread. On Linux an event is a futex word (utils/wait_for_event.c), so
+* a switch costs one FUTEX_WAKE and one FUTEX_WAIT.
 *
 * The timer interrupt uses SIGALRM and care is taken to ensure that
 * the signal handler runs only on the thread for the current task.
 *
+* Interrupts are disabled with a thread-local flag rather than the signal
+* mask, so critical sections make no system call. A SIGALRM that arrives
+* while the flag is set leaves its ticks pending; they are delivered when
+* interrupts are next enabled. vPortSetTickSafePoints() makes that the
+* normal path: the tick thread then signals only a task that has not
+* reached a safe point for a whole tick period.
+*
+* vPortSetSimulatedClock() replaces the wall clock: no tick thread is
+* started and the tick count only advances while the idle task runs, i.e.
+* while every other task is blocked. Tickless idle then jumps straight to
+* the next unblock time instead of sleeping, and vPortIdleHook()
+* (called from the idle hook) covers the single tick gaps that tickless
+* idle leaves alone. Kernel semantics are unchanged; only the time spent
+* with all tasks blocked shrinks to zero.
+*
 * Use of part of the standard C library requires care as some
 * functions can take pthread mutexes internally which can result in
 * deadlocks as the FreeRTOS kernel can switch tasks while they're
@@ -60,13 +76,14 @@
 #include "portmacro.h"
 #include <errno.h>
 #include <pthread.h>
+#include <sched.h>
 #include <limits.h>
 #include <signal.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/mman.h>
 #include <sys/time.h>
-#include <sys/times.h>
 #include <time.h>
 #include <unistd.h>
 
@@ -79,6 +96,10 @@
 
 #define SIG_RESUME    SIGUSR1
 
+/* Stack size of the port's threads when memory is locked: mlockall()
+ * with MCL_FUTURE locks a thread's whole stack as soon as it is mapped. */
+#define LOCKED_THREAD_STACK_SIZE    ( ( size_t ) 256 * 1024 )
+
 typedef struct THREAD
 {
     pthread_t pthread;
@@ -102,7 +123,6 @@ static inline Thread_t * prvGetThreadFromTask( TaskHandle_t xTask )
 /*-----------------------------------------------------------*/
 
 static pthread_once_t hSigSetupThread = PTHREAD_ONCE_INIT;
-static pthread_once_t hThreadKeyOnce = PTHREAD_ONCE_INIT;
 static sigset_t xAllSignals;
 static sigset_t xSchedulerOriginalSignalMask;
 static pthread_t hMainThread = ( pthread_t ) NULL;
@@ -111,11 +131,66 @@ static BaseType_t xSchedulerEnd = pdFALSE;
 static pthread_t hTimerTickThread;
 static bool xTimerTickThreadShouldRun;
 static uint64_t prvStartTimeNs;
-static pthread_key_t xThreadKey = 0;
+
+/* Tick source state. The tick thread owns ullTicksGenerated and
+ * ullTicksMissed; ullTicksPending is handed to the tick handler, which
+ * processes every pending tick so late or coalesced SIGALRMs do not lose
+ * time. */
+static uint64_t ullTicksGenerated = 0;
+static uint64_t ullTicksMissed = 0;
+static uint64_t ullTicksPending = 0;
+static uint64_t ullTicksProcessed = 0;
+static uint64_t ullTickSignals = 0;
+
+/* Tickless idle. While the idle task sleeps, the tick thread sends no
+ * SIGALRM until tick ullSuppressUntilTick, then hands the skipped ticks to
+ * the idle task in ullTicksToStep for vTaskStepTick(). Both threads
+ * update this state and the tick counters under xTickMutex. */
+static pthread_mutex_t xTickMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t xIdleWakeCond = PTHREAD_COND_INITIALIZER;
+static uint64_t ullSuppressUntilTick = 0;
+static uint64_t ullTicksToStep = 0;
+static uint64_t ullTicksStepped = 0;
+
+/* Tick thread wake-up latency past its deadline, under xTickMutex. */
+static uint64_t ullTickWakeups = 0;
+static uint64_t ullWakeLatencyTotalNs = 0;
+static uint64_t ullWakeLatencyMaxNs = 0;
+
+/* Per-thread state. Every thread starts with interrupts disabled; a task
+ * thread enables them once it is resumed for the first time. */
+static _Thread_local BaseType_t xIsFreeRTOSThread = pdFALSE;
+static _Thread_local volatile sig_atomic_t xInterruptsDisabled = 1;
+static uint64_t ullTicksDeferred = 0;
+
+/* Tick delivery. By default every tick period sends SIGALRM to the running
+ * task. With xTickSafePoints the tick thread only posts to ullTicksPending
+ * and vPortEnableInterrupts() (every critical section exit) processes the
+ * ticks; ullSafePointRuns counts those runs. */
+static BaseType_t xTickSafePoints = pdFALSE;
+static uint64_t ullSafePointRuns = 0;
+
+/* Simulated clock: set before the scheduler starts, only the idle task
+ * advances the tick count. */
+static BaseType_t xSimulatedClock = pdFALSE;
+
+/* Run-time statistics counter origin, set before the scheduler starts. */
+static uint64_t ullRunTimeBaseNs = 0;
+
+/* Host scheduling of the port threads, set by iPortSetHostScheduling()
+ * before the scheduler starts. A CPU of -1 leaves a thread unpinned and a
+ * FIFO priority of 0 leaves it under SCHED_OTHER. */
+static int iHostTickCpu = -1;
+static int iHostTaskCpu = -1;
+static int iHostFifoPriority = 0;
+static size_t uxHostThreadStackSize = 0; /* 0: the pthread default. */
+
+static BaseType_t xTimerTickThreadStarted = pdFALSE;
 /*-----------------------------------------------------------*/
 
 static void prvSetupSignalsAndSchedulerPolicy( void );
 static void prvSetupTimerInterrupt( void );
+static uint64_t prvGetTimeNs( void );
 static void * prvWaitForStart( void * pvParams );
 static void prvSwitchThread( Thread_t * xThreadToResume,
                              Thread_t * xThreadToSuspend );
@@ -124,68 +199,95 @@ static void prvResumeThread( Thread_t * xThreadId );
 static void vPortSystemTickHandler( int sig );
 static void vPortStartFirstTask( void );
 static void prvPortYieldFromISR( void );
-static void prvThreadKeyDestructor( void * pvData );
-static void prvInitThreadKey( void );
+static void prvProcessTicks( void );
 static void prvMarkAsFreeRTOSThread( void );
 static BaseType_t prvIsFreeRTOSThread( void );
-static void prvDestroyThreadKey( void );
+static void prvFatalError( const char * pcCall,
+                           int iErrno ) __attribute__( ( __noreturn__ ) );
 /*-----------------------------------------------------------*/
 
-static void prvThreadKeyDestructor( void * pvData )
-{
-    free( pvData );
-}
-/*-----------------------------------------------------------*/
+#ifdef __linux__
 
-static void prvInitThreadKey( void )
+static int prvCheckHostCpu( int iCpu,
+                            const cpu_set_t * pxAllowed )
 {
-    pthread_key_create( &xThreadKey, prvThreadKeyDestructor );
-    /* Destroy xThreadKey when the process exits. */
-    atexit( prvDestroyThreadKey );
+    if( iCpu < 0 )
+    {
+        return 0;
+    }
+
+    if( ( iCpu >= CPU_SETSIZE ) || !CPU_ISSET( iCpu, pxAllowed ) )
+    {
+        return EINVAL;
+    }
+
+    return 0;
 }
 /*-----------------------------------------------------------*/
 
-static void prvMarkAsFreeRTOSThread( void )
+/* Apply the host scheduling options to the attributes of a new port thread. */
+static void prvSetHostAttributes( pthread_attr_t * pxAttr,
+                                  int iCpu,
+                                  int iFifoPriority )
 {
-    uint8_t * pucThreadData = NULL;
-
-    ( void ) pthread_once( &hThreadKeyOnce, prvInitThreadKey );
-
-    pucThreadData = malloc( 1 );
-    configASSERT( pucThreadData != NULL );
+    int iRet;
 
-    *pucThreadData = 1;
+    if( iCpu >= 0 )
+    {
+        cpu_set_t xCpus;
 
-    pthread_setspecific( xThreadKey, pucThreadData );
-}
-/*-----------------------------------------------------------*/
+        CPU_ZERO( &xCpus );
+        CPU_SET( iCpu, &xCpus );
+        iRet = pthread_attr_setaffinity_np( pxAttr, sizeof( xCpus ), &xCpus );
 
-static BaseType_t prvIsFreeRTOSThread( void )
-{
-    uint8_t * pucThreadData = NULL;
-    BaseType_t xRet = pdFALSE;
+        if( iRet != 0 )
+        {
+            prvFatalError( "pthread_attr_setaffinity_np", iRet );
+        }
+    }
 
-    ( void ) pthread_once( &hThreadKeyOnce, prvInitThreadKey );
+    if( iFifoPriority > 0 )
+    {
+        struct sched_param xParam;
 
-    pucThreadData = ( uint8_t * ) pthread_getspecific( xThreadKey );
+        memset( &xParam, 0, sizeof( xParam ) );
+        xParam.sched_priority = iFifoPriority;
+        ( void ) pthread_attr_setinheritsched( pxAttr, PTHREAD_EXPLICIT_SCHED );
+        ( void ) pthread_attr_setschedpolicy( pxAttr, SCHED_FIFO );
+        ( void ) pthread_attr_setschedparam( pxAttr, &xParam );
+    }
 
-    if( ( pucThreadData != NULL ) && ( *pucThreadData == 1 ) )
+    if( uxHostThreadStackSize != 0 )
     {
-        xRet = pdTRUE;
+        ( void ) pthread_attr_setstacksize( pxAttr, uxHostThreadStackSize );
     }
+}
 
-    return xRet;
+#else /* __linux__ */
+
+static void prvSetHostAttributes( pthread_attr_t * pxAttr,
+                                  int iCpu,
+                                  int iFifoPriority )
+{
+    ( void ) pxAttr;
+    ( void ) iCpu;
+    ( void ) iFifoPriority;
 }
+
+#endif /* __linux__ */
 /*-----------------------------------------------------------*/
 
-static void prvDestroyThreadKey( void )
+static void prvMarkAsFreeRTOSThread( void )
 {
-    pthread_key_delete( xThreadKey );
+    xIsFreeRTOSThread = pdTRUE;
 }
 /*-----------------------------------------------------------*/
 
-static void prvFatalError( const char * pcCall,
-                           int iErrno ) __attribute__( ( __noreturn__ ) );
+static BaseType_t prvIsFreeRTOSThread( void )
+{
+    return xIsFreeRTOSThread;
+}
+/*-----------------------------------------------------------*/
 
 void prvFatalError( const char * pcCall,
                     int iErrno )
@@ -215,6 +317,7 @@ StackType_t * pxPortInitialiseStack( StackType_t * pxTopOfStack,
 {
     Thread_t * thread;
     pthread_attr_t xThreadAttributes;
+    sigset_t xCreatorSignals;
     size_t ulStackSize;
     int iRet;
 
@@ -236,10 +339,15 @@ StackType_t * pxPortInitialiseStack( StackType_t * pxTopOfStack,
     thread->xDying = pdFALSE;
 
     pthread_attr_init( &xThreadAttributes );
+    prvSetHostAttributes( &xThreadAttributes, iHostTaskCpu, iHostFifoPriority );
 
     thread->ev = event_create();
 
+    /* Critical sections no longer touch the signal mask, so block all
+     * signals while creating the thread: it inherits the mask and cannot
+     * take a SIGALRM before it has been resumed. */
     vPortEnterCritical();
+    ( void ) pthread_sigmask( SIG_BLOCK, &xAllSignals, &xCreatorSignals );
 
     iRet = pthread_create( &thread->pthread, &xThreadAttributes,
                            prvWaitForStart, thread );
@@ -249,6 +357,7 @@ StackType_t * pxPortInitialiseStack( StackType_t * pxTopOfStack,
         prvFatalError( "pthread_create", iRet );
     }
 
+    ( void ) pthread_sigmask( SIG_SETMASK, &xCreatorSignals, NULL );
     vPortExitCritical();
 
     return pxTopOfStack;
@@ -276,8 +385,16 @@ BaseType_t xPortStartScheduler( void )
     prvPortSetCurrentThreadName( "Scheduler" );
 
     /* Start the timer that generates the tick ISR(SIGALRM).
-     * Interrupts are disabled here already. */
-    prvSetupTimerInterrupt();
+     * Interrupts are disabled here already. A simulated clock has no tick
+     * source; the idle task advances time. */
+    if( xSimulatedClock == pdFALSE )
+    {
+        prvSetupTimerInterrupt();
+    }
+    else
+    {
+        prvStartTimeNs = prvGetTimeNs();
+    }
 
     /*
      * Block SIG_RESUME before starting any tasks so the main thread can sigwait on it.
@@ -291,11 +408,14 @@ BaseType_t xPortStartScheduler( void )
     /* Start the first task. */
     vPortStartFirstTask();
 
-    /* Wait until signaled by vPortEndScheduler(). */
-    while( xSchedulerEnd != pdTRUE )
+    /* Wait until signaled by vPortEndScheduler(). The signal is consumed
+     * even if the tasks ran to the end before this thread got here (e.g.
+     * under SCHED_FIFO on one CPU); left pending, it would be delivered
+     * when the original signal mask is restored and kill the process. */
+    do
     {
         sigwait( &xSignals, &iSignal );
-    }
+    } while( xSchedulerEnd != pdTRUE );
 
     /*
      * clear out the variable that is used to end the scheduler, otherwise
@@ -307,12 +427,9 @@ BaseType_t xPortStartScheduler( void )
      * memset the internal struct members for MacOS/Linux Compatibility */
     #if __APPLE__
         hSigSetupThread.__sig = _PTHREAD_ONCE_SIG_init;
-        hThreadKeyOnce.__sig = _PTHREAD_ONCE_SIG_init;
         memset( ( void * ) &hSigSetupThread.__opaque, 0, sizeof( hSigSetupThread.__opaque ) );
-        memset( ( void * ) &hThreadKeyOnce.__opaque, 0, sizeof( hThreadKeyOnce.__opaque ) );
     #else /* Linux PTHREAD library*/
         hSigSetupThread = ( pthread_once_t ) PTHREAD_ONCE_INIT;
-        hThreadKeyOnce = ( pthread_once_t ) PTHREAD_ONCE_INIT;
     #endif /* __APPLE__*/
 
     /* Restore original signal mask. */
@@ -329,7 +446,12 @@ void vPortEndScheduler( void )
 
     /* Stop the timer tick thread. */
     xTimerTickThreadShouldRun = false;
-    pthread_join( hTimerTickThread, NULL );
+
+    if( xTimerTickThreadStarted == pdTRUE )
+    {
+        pthread_join( hTimerTickThread, NULL );
+        xTimerTickThreadStarted = pdFALSE;
+    }
 
     /* Check whether the current thread is a FreeRTOS thread.
      * This has to happen before the scheduler is signaled to exit
@@ -405,18 +527,25 @@ void vPortYield( void )
 
 void vPortDisableInterrupts( void )
 {
-    if( prvIsFreeRTOSThread() == pdTRUE )
-    {
-        pthread_sigmask( SIG_BLOCK, &xAllSignals, NULL );
-    }
+    xInterruptsDisabled = 1;
+    __atomic_signal_fence( __ATOMIC_SEQ_CST );
 }
 /*-----------------------------------------------------------*/
 
 void vPortEnableInterrupts( void )
 {
-    if( prvIsFreeRTOSThread() == pdTRUE )
+    __atomic_signal_fence( __ATOMIC_SEQ_CST );
+    xInterruptsDisabled = 0;
+    __atomic_signal_fence( __ATOMIC_SEQ_CST );
+
+    /* Deliver ticks whose SIGALRM arrived while interrupts were disabled,
+     * or was sent to a thread that has since been switched out. Only the
+     * running task's thread enables interrupts, so it is the right one. */
+    if( ( xIsFreeRTOSThread == pdTRUE ) &&
+        ( __atomic_load_n( &ullTicksPending, __ATOMIC_RELAXED ) != 0 ) )
     {
-        pthread_sigmask( SIG_UNBLOCK, &xAllSignals, NULL );
+        __atomic_add_fetch( &ullSafePointRuns, 1, __ATOMIC_RELAXED );
+        prvProcessTicks();
     }
 }
 /*-----------------------------------------------------------*/
@@ -445,12 +574,37 @@ static uint64_t prvGetTimeNs( void )
 }
 /*-----------------------------------------------------------*/
 
-/* commented as part of the code below in vPortSystemTickHandler,
- * to adjust timing according to full demo requirements */
-/* static uint64_t prvTickCount; */
+/* Sleep until an absolute CLOCK_MONOTONIC time in nanoseconds. */
+static void prvSleepUntilNs( uint64_t ullDeadlineNs )
+{
+    #ifdef __APPLE__
+        uint64_t ullNowNs = prvGetTimeNs();
+
+        while( ullNowNs < ullDeadlineNs )
+        {
+            struct timespec xDelay;
+            xDelay.tv_sec = ( time_t ) ( ( ullDeadlineNs - ullNowNs ) / 1000000000ULL );
+            xDelay.tv_nsec = ( long ) ( ( ullDeadlineNs - ullNowNs ) % 1000000000ULL );
+            nanosleep( &xDelay, NULL );
+            ullNowNs = prvGetTimeNs();
+        }
+    #else
+        struct timespec xDeadline;
+
+        xDeadline.tv_sec = ( time_t ) ( ullDeadlineNs / 1000000000ULL );
+        xDeadline.tv_nsec = ( long ) ( ullDeadlineNs % 1000000000ULL );
+
+        while( clock_nanosleep( CLOCK_MONOTONIC, TIMER_ABSTIME, &xDeadline, NULL ) == EINTR )
+        {
+        }
+    #endif
+}
+/*-----------------------------------------------------------*/
 
 static void * prvTimerTickHandler( void * arg )
 {
+    const uint64_t ullTickPeriodNs = ( uint64_t ) portTICK_RATE_MICROSECONDS * 1000ULL;
+
     ( void ) arg;
 
     prvMarkAsFreeRTOSThread();
@@ -459,13 +613,96 @@ static void * prvTimerTickHandler( void * arg )
 
     while( xTimerTickThreadShouldRun )
     {
+        uint64_t ullDue;
+        uint64_t ullNextTick;
+        uint64_t ullDeadlineNs;
+        uint64_t ullNowNs;
+        uint64_t ullLateNs;
+        uint64_t ullNewTicks;
+        uint64_t ullPrevPending;
+
+        /*
+         * Tick n is due at prvStartTimeNs + n periods. Sleeping to an
+         * absolute deadline keeps signal delivery and scheduling latency
+         * from accumulating into drift. While the idle task sleeps the
+         * thread sleeps straight to the wake-up tick.
+         */
+        pthread_mutex_lock( &xTickMutex );
+        ullNextTick = ullTicksGenerated + 1;
+
+        if( ullSuppressUntilTick > ullNextTick )
+        {
+            ullNextTick = ullSuppressUntilTick;
+        }
+
+        pthread_mutex_unlock( &xTickMutex );
+
+        ullDeadlineNs = prvStartTimeNs + ullNextTick * ullTickPeriodNs;
+        prvSleepUntilNs( ullDeadlineNs );
+
+        ullNowNs = prvGetTimeNs();
+        ullDue = ( ullNowNs - prvStartTimeNs ) / ullTickPeriodNs;
+
+        pthread_mutex_lock( &xTickMutex );
+
+        ullLateNs = ( ullNowNs > ullDeadlineNs ) ? ullNowNs - ullDeadlineNs : 0;
+        ullTickWakeups++;
+        ullWakeLatencyTotalNs += ullLateNs;
+
+        if( ullLateNs > ullWakeLatencyMaxNs )
+        {
+            ullWakeLatencyMaxNs = ullLateNs;
+        }
+
+        if( ullSuppressUntilTick != 0 )
+        {
+            if( ullDue < ullSuppressUntilTick )
+            {
+                /* Idle started sleeping after this wake-up was scheduled;
+                 * hold the ticks back for the step. */
+                pthread_mutex_unlock( &xTickMutex );
+                continue;
+            }
+
+            /* The sleep window is stepped by the idle task; only ticks past
+             * the wake-up tick (a late wake-up) are delivered normally. */
+            ullTicksToStep = ullSuppressUntilTick - ullTicksGenerated;
+            ullTicksGenerated = ullSuppressUntilTick;
+            ullSuppressUntilTick = 0;
+            pthread_cond_signal( &xIdleWakeCond );
+        }
+
+        if( ullDue <= ullTicksGenerated )
+        {
+            pthread_mutex_unlock( &xTickMutex );
+            continue;
+        }
+
+        /* If the thread woke late, every period that elapsed is still
+         * delivered (compensated) and counted as missed. */
+        ullNewTicks = ullDue - ullTicksGenerated;
+        ullTicksMissed += ullNewTicks - 1;
+        ullTicksGenerated = ullDue;
+        ullPrevPending = __atomic_fetch_add( &ullTicksPending, ullNewTicks, __ATOMIC_RELEASE );
+
+        /* In safe-point mode the running task picks the ticks up when it
+         * next enables interrupts. Only a task that went a whole tick
+         * period without doing so (busy in its own code) is signaled. */
+        if( ( xTickSafePoints == pdTRUE ) && ( ullPrevPending == 0 ) )
+        {
+            pthread_mutex_unlock( &xTickMutex );
+            continue;
+        }
+
+        ullTickSignals++;
+        pthread_mutex_unlock( &xTickMutex );
+
         /*
          * signal to the active task to cause tick handling or
          * preemption (if enabled)
          */
         Thread_t * thread = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
         pthread_kill( thread->pthread, SIGALRM );
-        usleep( portTICK_RATE_MICROSECONDS );
     }
 
     return NULL;
@@ -478,42 +715,90 @@ static void * prvTimerTickHandler( void * arg )
  */
 void prvSetupTimerInterrupt( void )
 {
-    xTimerTickThreadShouldRun = true;
-    pthread_create( &hTimerTickThread, NULL, prvTimerTickHandler, NULL );
+    pthread_attr_t xThreadAttributes;
+    int iRet;
 
+    /* The tick thread computes its deadlines from the start time. */
     prvStartTimeNs = prvGetTimeNs();
+
+    xTimerTickThreadShouldRun = true;
+
+    pthread_attr_init( &xThreadAttributes );
+    prvSetHostAttributes( &xThreadAttributes, iHostTickCpu,
+                          ( iHostFifoPriority > 0 ) ? iHostFifoPriority + 1 : 0 );
+    iRet = pthread_create( &hTimerTickThread, &xThreadAttributes, prvTimerTickHandler, NULL );
+    pthread_attr_destroy( &xThreadAttributes );
+
+    /* Without the tick thread the idle task would wait for a tick forever. */
+    if( iRet != 0 )
+    {
+        prvFatalError( "pthread_create", iRet );
+    }
+
+    xTimerTickThreadStarted = pdTRUE;
 }
 /*-----------------------------------------------------------*/
 
-static void vPortSystemTickHandler( int sig )
+static void prvProcessTicks( void )
 {
-    if( prvIsFreeRTOSThread() == pdTRUE )
-    {
-        Thread_t * pxThreadToSuspend;
-        Thread_t * pxThreadToResume;
+    Thread_t * pxThreadToSuspend;
+    Thread_t * pxThreadToResume;
+    BaseType_t xSwitchRequired = pdFALSE;
+    uint64_t ullTicks;
 
-        ( void ) sig;
+    xInterruptsDisabled = 1;
+    uxCriticalNesting++;
 
-        uxCriticalNesting++; /* Signals are blocked in this signal handler. */
+    pxThreadToSuspend = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
 
-        pxThreadToSuspend = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+    /* Process every tick generated since the last run. A signal raised
+     * while another was pending is merged by the OS, and a signal can be
+     * deferred or land on a thread that was switched out. */
+    ullTicks = __atomic_exchange_n( &ullTicksPending, 0, __ATOMIC_ACQUIRE );
+    ullTicksProcessed += ullTicks;
 
+    while( ullTicks > 0 )
+    {
         if( xTaskIncrementTick() != pdFALSE )
         {
-            /* Select Next Task. */
-            vTaskSwitchContext();
+            xSwitchRequired = pdTRUE;
+        }
 
-            pxThreadToResume = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+        ullTicks--;
+    }
 
-            prvSwitchThread( pxThreadToResume, pxThreadToSuspend );
-        }
+    if( xSwitchRequired != pdFALSE )
+    {
+        /* Select Next Task. */
+        vTaskSwitchContext();
 
-        uxCriticalNesting--;
+        pxThreadToResume = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+
+        prvSwitchThread( pxThreadToResume, pxThreadToSuspend );
     }
-    else
+
+    uxCriticalNesting--;
+    xInterruptsDisabled = 0;
+}
+/*-----------------------------------------------------------*/
+
+static void vPortSystemTickHandler( int sig )
+{
+    ( void ) sig;
+
+    if( prvIsFreeRTOSThread() == pdFALSE )
     {
         fprintf( stderr, "vPortSystemTickHandler called from non-FreeRTOS thread\n" );
     }
+    else if( xInterruptsDisabled != 0 )
+    {
+        /* The ticks stay in ullTicksPending until vPortEnableInterrupts(). */
+        __atomic_add_fetch( &ullTicksDeferred, 1, __ATOMIC_RELAXED );
+    }
+    else
+    {
+        prvProcessTicks();
+    }
 }
 /*-----------------------------------------------------------*/
 
@@ -550,8 +835,10 @@ static void * prvWaitForStart( void * pvParams )
 
     prvSuspendSelf( pxThread );
 
-    /* Resumed for the first time, unblocks all signals. */
+    /* Resumed for the first time: unblock all signals once, from now on
+     * interrupts are masked with the thread-local flag only. */
     uxCriticalNesting = 0;
+    ( void ) pthread_sigmask( SIG_UNBLOCK, &xAllSignals, NULL );
     vPortEnableInterrupts();
 
     /* Set thread name */
@@ -604,17 +891,20 @@ static void prvSwitchThread( Thread_t * pxThreadToResume,
 static void prvSuspendSelf( Thread_t * thread )
 {
     /*
-     * Suspend this thread by waiting for a pthread_cond_signal event.
+     * Suspend this thread by waiting for its event to be signaled.
      *
-     * A suspended thread must not handle signals (interrupts) so
-     * all signals must be blocked by calling this from:
+     * A suspended thread must not handle interrupts so this must be
+     * called with interrupts disabled:
      *
      * - Inside a critical section (vPortEnterCritical() /
      *   vPortExitCritical()).
      *
-     * - From a signal handler that has all signals masked.
+     * - From the tick handler.
+     *
+     * - From a thread that has not been resumed yet.
      *
-     * - A thread with all signals blocked with pthread_sigmask().
+     * A SIGALRM sent to a suspended thread only interrupts the wait; the
+     * handler leaves its ticks pending.
      */
     event_wait( thread->ev );
     pthread_testcancel();
@@ -656,7 +946,9 @@ static void prvSetupSignalsAndSchedulerPolicy( void )
                               &xAllSignals,
                               &xSchedulerOriginalSignalMask );
 
-    sigtick.sa_flags = 0;
+    /* Restart interrupted system calls: a tick that lands in a blocking
+     * write() on a full pipe must not make stdio drop output. */
+    sigtick.sa_flags = SA_RESTART;
     sigtick.sa_handler = vPortSystemTickHandler;
     sigfillset( &sigtick.sa_mask );
 
@@ -669,12 +961,200 @@ static void prvSetupSignalsAndSchedulerPolicy( void )
 }
 /*-----------------------------------------------------------*/
 
-uint32_t ulPortGetRunTime( void )
+void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime )
 {
-    struct tms xTimes;
+    uint64_t ullStep;
 
-    times( &xTimes );
+    if( xSimulatedClock == pdTRUE )
+    {
+        /* Every task is blocked: jump to the next unblock time. Nothing can
+         * wake a system whose tasks all wait without a timeout, so the
+         * clock is left to the idle hook in that case. */
+        if( ( eTaskConfirmSleepModeStatus() == eStandardSleep ) &&
+            ( ( TickType_t ) ( xTaskGetTickCount() + xExpectedIdleTime ) != portMAX_DELAY ) )
+        {
+            ullTicksStepped += xExpectedIdleTime;
+            vTaskStepTick( xExpectedIdleTime );
+        }
 
-    return ( uint32_t ) xTimes.tms_utime;
+        return;
+    }
+
+    /* Called by the idle task with the scheduler suspended. Interrupts
+     * stay disabled so a tick cannot be handled halfway through the sleep. */
+    vPortDisableInterrupts();
+    pthread_mutex_lock( &xTickMutex );
+
+    /* A tick that is generated but not yet handled means the kernel's tick
+     * count lags the tick thread; let it be processed first. */
+    if( ( eTaskConfirmSleepModeStatus() == eAbortSleep ) ||
+        ( __atomic_load_n( &ullTicksPending, __ATOMIC_ACQUIRE ) != 0 ) )
+    {
+        pthread_mutex_unlock( &xTickMutex );
+        vPortEnableInterrupts();
+        return;
+    }
+
+    ullSuppressUntilTick = ullTicksGenerated + xExpectedIdleTime;
+
+    while( ullSuppressUntilTick != 0 )
+    {
+        pthread_cond_wait( &xIdleWakeCond, &xTickMutex );
+    }
+
+    ullStep = ullTicksToStep;
+    ullTicksToStep = 0;
+    ullTicksStepped += ullStep;
+    pthread_mutex_unlock( &xTickMutex );
+
+    /* Reaching the unblock time pends the final tick, which
+     * xTaskResumeAll() processes after this returns. */
+    vTaskStepTick( ( TickType_t ) ullStep );
+
+    vPortEnableInterrupts();
+}
+/*-----------------------------------------------------------*/
+
+void vPortGetTickStats( PortTickStats_t * pxStats )
+{
+    pthread_mutex_lock( &xTickMutex );
+    pxStats->ullGenerated = ( xSimulatedClock == pdTRUE ) ? ullTicksProcessed + ullTicksStepped : ullTicksGenerated;
+    pxStats->xSimulated = xSimulatedClock;
+    pxStats->ullMissed = ullTicksMissed;
+    pxStats->ullSignals = ullTickSignals;
+    pxStats->ullStepped = ullTicksStepped;
+    pxStats->ullWakeups = ullTickWakeups;
+    pxStats->ullWakeLatencyNs = ullWakeLatencyTotalNs;
+    pxStats->ullMaxWakeLatencyNs = ullWakeLatencyMaxNs;
+    pthread_mutex_unlock( &xTickMutex );
+    pxStats->ullProcessed = ullTicksProcessed;
+    pxStats->ullDeferred = __atomic_load_n( &ullTicksDeferred, __ATOMIC_RELAXED );
+    pxStats->ullSafePointRuns = __atomic_load_n( &ullSafePointRuns, __ATOMIC_RELAXED );
+    pxStats->ullElapsedNs = prvGetTimeNs() - prvStartTimeNs;
+}
+/*-----------------------------------------------------------*/
+
+void vPortSetSimulatedClock( BaseType_t xEnable )
+{
+    /* Set before the scheduler starts. */
+    xSimulatedClock = xEnable;
+}
+/*-----------------------------------------------------------*/
+
+void vPortIdleHook( void )
+{
+    /* Tickless idle only steps gaps of configEXPECTED_IDLE_TIME_BEFORE_SLEEP
+     * ticks or more; advance the remaining single ticks here. The idle task
+     * runs only while every other task is blocked. */
+    if( xSimulatedClock == pdTRUE )
+    {
+        ullTicksProcessed++;
+        ( void ) xTaskCatchUpTicks( 1 );
+    }
+}
+/*-----------------------------------------------------------*/
+
+void vPortSetTickSafePoints( BaseType_t xEnable )
+{
+    /* Set before the scheduler starts; read by the tick thread. */
+    xTickSafePoints = xEnable;
+}
+/*-----------------------------------------------------------*/
+
+void vPortSetSwitchSpin( uint32_t ulSpinCount )
+{
+    /* Polls made by a suspending thread before it sleeps. Spinning only
+     * helps when the resumed thread runs on another host CPU. */
+    event_set_spin( ulSpinCount );
+}
+/*-----------------------------------------------------------*/
+
+int iPortSetHostScheduling( const PortHostScheduling_t * pxConfig )
+{
+    #ifdef __linux__
+        cpu_set_t xAllowed;
+        int iRet;
+
+        /* Only CPUs in the process's affinity mask can be used. */
+        if( sched_getaffinity( 0, sizeof( xAllowed ), &xAllowed ) != 0 )
+        {
+            return errno;
+        }
+
+        iRet = prvCheckHostCpu( pxConfig->iTickCpu, &xAllowed );
+
+        if( iRet == 0 )
+        {
+            iRet = prvCheckHostCpu( pxConfig->iTaskCpu, &xAllowed );
+        }
+
+        if( iRet != 0 )
+        {
+            return iRet;
+        }
+
+        if( pxConfig->iFifoPriority != 0 )
+        {
+            int iPolicy;
+            struct sched_param xSaved;
+            struct sched_param xParam;
+
+            /* The tick thread runs one priority above the tasks. */
+            if( ( pxConfig->iFifoPriority < sched_get_priority_min( SCHED_FIFO ) ) ||
+                ( pxConfig->iFifoPriority + 1 > sched_get_priority_max( SCHED_FIFO ) ) )
+            {
+                return EINVAL;
+            }
+
+            /* Threads are created long after this call; check the
+             * privilege here, on the calling thread, and restore it. */
+            ( void ) pthread_getschedparam( pthread_self(), &iPolicy, &xSaved );
+            memset( &xParam, 0, sizeof( xParam ) );
+            xParam.sched_priority = pxConfig->iFifoPriority + 1;
+            iRet = pthread_setschedparam( pthread_self(), SCHED_FIFO, &xParam );
+
+            if( iRet != 0 )
+            {
+                return iRet;
+            }
+
+            ( void ) pthread_setschedparam( pthread_self(), iPolicy, &xSaved );
+        }
+
+        if( pxConfig->xLockMemory == pdTRUE )
+        {
+            /* MCL_FUTURE locks every later mapping in full, thread stacks
+             * included, so the port's threads get smaller stacks. */
+            if( mlockall( MCL_CURRENT | MCL_FUTURE ) != 0 )
+            {
+                return errno;
+            }
+
+            uxHostThreadStackSize = LOCKED_THREAD_STACK_SIZE;
+        }
+
+        iHostTickCpu = pxConfig->iTickCpu;
+        iHostTaskCpu = pxConfig->iTaskCpu;
+        iHostFifoPriority = pxConfig->iFifoPriority;
+
+        return 0;
+    #else /* __linux__ */
+        ( void ) pxConfig;
+
+        return ENOTSUP;
+    #endif /* __linux__ */
+}
+/*-----------------------------------------------------------*/
+
+void vPortConfigureRunTimeCounter( void )
+{
+    ullRunTimeBaseNs = prvGetTimeNs();
+}
+/*-----------------------------------------------------------*/
+
+uint64_t ullPortGetRunTimeCounter( void )
+{
+    /* Read on every context switch; CLOCK_MONOTONIC is a vDSO call. */
+    return prvGetTimeNs() - ullRunTimeBaseNs;
 }
 /*-----------------------------------------------------------*/
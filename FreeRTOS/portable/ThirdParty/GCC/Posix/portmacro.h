@@ -78,6 +78,30 @@ typedef unsigned long    TickType_t;
 #define portBYTE_ALIGNMENT                 8
 /*-----------------------------------------------------------*/
 
+/* Port optimised task selection: the ready priorities are kept as a bit map
+ * in uxTopReadyPriority and the highest one is found with a count leading
+ * zeros instruction, so selection takes constant time whatever the number of
+ * priorities, up to one per bit of UBaseType_t. */
+#if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 1 )
+
+    #define portMAX_OPTIMISED_PRIORITIES    ( __SIZEOF_LONG__ * 8 )
+
+    /* Check the configuration. */
+    #if ( configMAX_PRIORITIES > portMAX_OPTIMISED_PRIORITIES )
+        #error configUSE_PORT_OPTIMISED_TASK_SELECTION can only be set to 1 when configMAX_PRIORITIES fits in the bits of UBaseType_t.
+    #endif
+
+    /* Store/clear the ready priorities in a bit map. */
+    #define portRECORD_READY_PRIORITY( uxPriority, uxReadyPriorities )    ( uxReadyPriorities ) |= ( ( ( UBaseType_t ) 1 ) << ( uxPriority ) )
+    #define portRESET_READY_PRIORITY( uxPriority, uxReadyPriorities )     ( uxReadyPriorities ) &= ~( ( ( UBaseType_t ) 1 ) << ( uxPriority ) )
+
+    /* The idle task is always ready, so the bit map is never zero here. */
+    #define portGET_HIGHEST_PRIORITY( uxTopPriority, uxReadyPriorities ) \
+    uxTopPriority = ( UBaseType_t ) ( portMAX_OPTIMISED_PRIORITIES - 1 ) - ( UBaseType_t ) __builtin_clzl( ( uxReadyPriorities ) )
+
+#endif /* configUSE_PORT_OPTIMISED_TASK_SELECTION */
+/*-----------------------------------------------------------*/
+
 /* Scheduler utilities. */
 extern void vPortYield( void );
 
@@ -140,9 +164,65 @@ extern void vPortCancelThread( void * pxTaskToDelete );
  */
 #define portMEMORY_BARRIER()                        __asm volatile ( "" ::: "memory" )
 
-extern uint32_t ulPortGetRunTime( void );
-#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()    /* no-op */
-#define portGET_RUN_TIME_COUNTER_VALUE()            ulPortGetRunTime()
+/* Tickless idle: the idle task sleeps until the next unblock time and the
+ * skipped ticks are stepped on wake-up. */
+extern void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime );
+#define portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime )    vPortSuppressTicksAndSleep( xExpectedIdleTime )
+
+/* Tick source statistics. */
+typedef struct PORT_TICK_STATS
+{
+    uint64_t ullGenerated; /* Ticks elapsed on the tick thread's timeline. */
+    uint64_t ullMissed;    /* Ticks found overdue (delivered late, not lost). */
+    uint64_t ullSignals;   /* SIGALRMs sent by the tick thread. */
+    uint64_t ullProcessed; /* Ticks processed by the tick handler. */
+    uint64_t ullStepped;   /* Ticks skipped in tickless idle and stepped. */
+    uint64_t ullDeferred;  /* SIGALRMs that arrived with interrupts disabled. */
+    uint64_t ullSafePointRuns; /* Pending ticks processed on enabling interrupts. */
+    uint64_t ullWakeups;   /* Tick thread wake-ups. */
+    uint64_t ullWakeLatencyNs;    /* Total wake-up latency past the deadlines. */
+    uint64_t ullMaxWakeLatencyNs; /* Worst wake-up latency. */
+    uint64_t ullElapsedNs; /* Time since the scheduler started. */
+    BaseType_t xSimulated; /* Ticks advance only while all tasks are blocked. */
+} PortTickStats_t;
+
+extern void vPortGetTickStats( PortTickStats_t * pxStats );
+
+/* Deliver ticks at safe points (interrupt enable) instead of one SIGALRM
+ * per tick; a task that reaches none for a tick period is still signaled. */
+extern void vPortSetTickSafePoints( BaseType_t xEnable );
+
+/* Simulated clock: no tick source, the tick count jumps to the next unblock
+ * time whenever every task is blocked. vPortIdleHook() must be called from
+ * the application idle hook. */
+extern void vPortSetSimulatedClock( BaseType_t xEnable );
+extern void vPortIdleHook( void );
+
+/* Context switch hand-off: polls made before a suspending thread sleeps. */
+extern void vPortSetSwitchSpin( uint32_t ulSpinCount );
+
+/* Host scheduling of the port threads, set before the scheduler starts.
+ * The tick thread and the task threads are pinned to one CPU each (-1: not
+ * pinned) and optionally run under SCHED_FIFO at iFifoPriority, the tick
+ * thread one priority higher (0: SCHED_OTHER). xLockMemory locks all
+ * current and future memory with mlockall(). Returns 0 or an errno value;
+ * Linux only. */
+typedef struct PORT_HOST_SCHEDULING
+{
+    int iTickCpu;
+    int iTaskCpu;
+    int iFifoPriority;
+    BaseType_t xLockMemory;
+} PortHostScheduling_t;
+
+extern int iPortSetHostScheduling( const PortHostScheduling_t * pxConfig );
+
+/* Run-time statistics: a 64-bit count of CLOCK_MONOTONIC nanoseconds since
+ * the scheduler was started (configRUN_TIME_COUNTER_TYPE must be uint64_t). */
+extern void vPortConfigureRunTimeCounter( void );
+extern uint64_t ullPortGetRunTimeCounter( void );
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()    vPortConfigureRunTimeCounter()
+#define portGET_RUN_TIME_COUNTER_VALUE()            ullPortGetRunTimeCounter()
 
 /* *INDENT-OFF* */
 #ifdef __cplusplus
@@ -26,6 +26,9 @@
  *
  */
 
+#ifdef __linux__
+    #define _GNU_SOURCE
+#endif
 #ifndef _XOPEN_SOURCE
 #define _XOPEN_SOURCE 700
 #endif
@@ -33,8 +36,181 @@
 #include <stdlib.h>
 #include <errno.h>
 
+#ifdef __linux__
+    #include <linux/futex.h>
+    #include <stdint.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
 #include "wait_for_event.h"
 
+/* Polls of the event word before a waiter sleeps; see event_set_spin(). */
+static unsigned int uxEventSpinCount = 0;
+
+#ifdef __linux__
+
+/*
+ * On Linux an event is a single futex word, so a hand-off between two
+ * threads costs one FUTEX_WAKE and one FUTEX_WAIT and no lock:
+ *
+ * EVENT_CLEAR   - not triggered, nobody sleeping.
+ * EVENT_SET     - triggered, the next wait returns at once.
+ * EVENT_WAITING - not triggered, the waiter sleeps (or is about to) in
+ *                 FUTEX_WAIT and the signaller has to wake it.
+ *
+ * Each event has a single waiter (the thread it belongs to). There is no
+ * mutex that a cancelled thread could die holding.
+ */
+#define EVENT_CLEAR      0U
+#define EVENT_SET        1U
+#define EVENT_WAITING    2U
+
+struct event
+{
+    uint32_t ulState;
+};
+/*-----------------------------------------------------------*/
+
+static inline void prvEventPause( void )
+{
+    #if defined( __x86_64__ ) || defined( __i386__ )
+        __builtin_ia32_pause();
+    #elif defined( __aarch64__ )
+        __asm__ __volatile__ ( "yield" );
+    #endif
+}
+/*-----------------------------------------------------------*/
+
+/* Consume the event if it is set. */
+static inline bool prvEventTryConsume( struct event * ev )
+{
+    uint32_t ulExpected = EVENT_SET;
+
+    return __atomic_compare_exchange_n( &ev->ulState, &ulExpected, EVENT_CLEAR, false,
+                                        __ATOMIC_ACQUIRE, __ATOMIC_RELAXED );
+}
+/*-----------------------------------------------------------*/
+
+/* Spin briefly in case the signaller runs on another CPU and is about to
+ * hand over; this avoids the sleep and the wake-up syscall entirely. */
+static bool prvEventSpin( struct event * ev )
+{
+    unsigned int uxSpin;
+
+    for( uxSpin = 0; uxSpin < uxEventSpinCount; uxSpin++ )
+    {
+        if( ( __atomic_load_n( &ev->ulState, __ATOMIC_RELAXED ) == EVENT_SET ) &&
+            prvEventTryConsume( ev ) )
+        {
+            return true;
+        }
+
+        prvEventPause();
+    }
+
+    return false;
+}
+/*-----------------------------------------------------------*/
+
+/* Sleep until the event is set or the relative timeout expires. Returns
+ * false only on timeout. */
+static bool prvEventSleep( struct event * ev,
+                           const struct timespec * pxTimeout )
+{
+    for( ; ; )
+    {
+        uint32_t ulExpected = EVENT_CLEAR;
+
+        if( prvEventTryConsume( ev ) )
+        {
+            return true;
+        }
+
+        /* Announce the sleeper; if the event was set meanwhile, take it. */
+        if( !__atomic_compare_exchange_n( &ev->ulState, &ulExpected, EVENT_WAITING, false,
+                                          __ATOMIC_ACQUIRE, __ATOMIC_RELAXED ) &&
+            ( ulExpected != EVENT_WAITING ) )
+        {
+            continue;
+        }
+
+        /* Returns at once if the word is no longer EVENT_WAITING. EINTR
+         * (signal or pthread_cancel) and EAGAIN simply retry. */
+        if( ( syscall( SYS_futex, &ev->ulState, FUTEX_WAIT_PRIVATE, EVENT_WAITING,
+                       pxTimeout, NULL, 0 ) == -1 ) && ( errno == ETIMEDOUT ) )
+        {
+            ulExpected = EVENT_WAITING;
+            __atomic_compare_exchange_n( &ev->ulState, &ulExpected, EVENT_CLEAR, false,
+                                         __ATOMIC_RELAXED, __ATOMIC_RELAXED );
+
+            return prvEventTryConsume( ev );
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+struct event * event_create( void )
+{
+    struct event * ev = malloc( sizeof( struct event ) );
+
+    if( ev != NULL )
+    {
+        ev->ulState = EVENT_CLEAR;
+    }
+
+    return ev;
+}
+/*-----------------------------------------------------------*/
+
+void event_delete( struct event * ev )
+{
+    free( ev );
+}
+/*-----------------------------------------------------------*/
+
+bool event_wait( struct event * ev )
+{
+    if( prvEventSpin( ev ) )
+    {
+        return true;
+    }
+
+    return prvEventSleep( ev, NULL );
+}
+/*-----------------------------------------------------------*/
+
+bool event_wait_timed( struct event * ev,
+                       time_t ms )
+{
+    struct timespec ts;
+
+    if( prvEventSpin( ev ) )
+    {
+        return true;
+    }
+
+    /* FUTEX_WAIT takes a relative timeout. A retry after EINTR restarts it,
+     * which is acceptable for the timed waits of this port. */
+    ts.tv_sec = ms / 1000;
+    ts.tv_nsec = ( ms % 1000 ) * 1000000;
+
+    return prvEventSleep( ev, &ts );
+}
+/*-----------------------------------------------------------*/
+
+void event_signal( struct event * ev )
+{
+    /* Only a sleeping waiter costs a system call. */
+    if( __atomic_exchange_n( &ev->ulState, EVENT_SET, __ATOMIC_RELEASE ) == EVENT_WAITING )
+    {
+        syscall( SYS_futex, &ev->ulState, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0 );
+    }
+}
+/*-----------------------------------------------------------*/
+
+#else /* __linux__ */
+
 struct event
 {
     pthread_mutex_t mutex;
@@ -52,7 +228,7 @@ struct event * event_create( void )
     {
         ev->event_triggered = false;
         pthread_mutexattr_init( &ev->mutexattr );
-        #if defined(__PTHREAD_MUTEX_HAVE_ROBUST) && !defined(__APPLE__)
+        #ifndef __APPLE__
             pthread_mutexattr_setrobust( &ev->mutexattr, PTHREAD_MUTEX_ROBUST );
         #endif
         pthread_mutex_init( &ev->mutex, &ev->mutexattr );
@@ -76,7 +252,7 @@ bool event_wait( struct event * ev )
 {
     if( pthread_mutex_lock( &ev->mutex ) == EOWNERDEAD )
     {
-        #if defined(__PTHREAD_MUTEX_HAVE_ROBUST) && !defined(__APPLE__)
+        #ifndef __APPLE__
             /* If the thread owning the mutex died, make the mutex consistent. */
             pthread_mutex_consistent( &ev->mutex );
         #endif
@@ -140,3 +316,11 @@ void event_signal( struct event * ev )
     pthread_mutex_unlock( &ev->mutex );
 }
 /*-----------------------------------------------------------*/
+
+#endif /* __linux__ */
+
+void event_set_spin( unsigned int uxSpinCount )
+{
+    uxEventSpinCount = uxSpinCount;
+}
+/*-----------------------------------------------------------*/
@@ -41,6 +41,8 @@ bool event_wait_timed( struct event * ev,
                        time_t ms );
 void event_signal( struct event * ev );
 
+/* Number of polls a waiter makes before sleeping (0 = sleep at once). */
+void event_set_spin( unsigned int uxSpinCount );
 
 
 #endif /* ifndef WAIT_FOR_EVENT_H_ */
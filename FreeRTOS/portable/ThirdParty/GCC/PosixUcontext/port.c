@@ -0,0 +1,911 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2020 Cambridge Consultants Ltd.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*-----------------------------------------------------------
+* Implementation of functions defined in portable.h for a single host
+* thread POSIX port.
+*
+* All tasks run on the thread that called vTaskStartScheduler(), each on
+* the stack FreeRTOS allocated for it. A context switch saves the
+* callee-saved registers on the current stack and loads the stack pointer
+* of the next task (a few instructions on x86-64, swapcontext() on other
+* architectures), so it involves no system call and no host scheduling,
+* and the number of tasks is limited by memory rather than by threads.
+*
+* Task code runs on the FreeRTOS stacks, so stack depths must allow for
+* the C library (printf() in particular); see FreeRTOSConfig.h.
+*
+* The tick thread is the only other thread. It follows the same absolute
+* clock_nanosleep() deadlines as the pthread port but never interrupts
+* the tasks: it posts elapsed ticks to a lock-free pending counter, which
+* the task thread processes at safe points, i.e. whenever interrupts are
+* enabled again (every critical section exit) and in the idle hook. A
+* task is therefore only preempted by the tick when it calls the kernel;
+* a task that loops in its own code without doing so is not.
+*
+* Tickless idle and the simulated clock work as in the pthread port.
+*----------------------------------------------------------*/
+#ifdef __linux__
+    #define _GNU_SOURCE
+#endif
+#include "portmacro.h"
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+
+#if !defined( __x86_64__ )
+    #include <ucontext.h>
+#endif
+
+/* Stack size of the port's threads when memory is locked: mlockall()
+ * with MCL_FUTURE locks a thread's whole stack as soon as it is mapped. */
+#define LOCKED_THREAD_STACK_SIZE    ( ( size_t ) 256 * 1024 )
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+/*-----------------------------------------------------------*/
+
+typedef struct THREAD
+{
+    #if defined( __x86_64__ )
+        void * pvStackPointer; /* Saved by prvSwitchStack(). */
+    #else
+        ucontext_t xContext;
+    #endif
+    TaskFunction_t pxCode;
+    void * pvParams;
+} Thread_t;
+
+/*
+ * The additional per-task data is stored at the beginning of the
+ * task's stack.
+ */
+static inline Thread_t * prvGetThreadFromTask( TaskHandle_t xTask )
+{
+    StackType_t * pxTopOfStack = *( StackType_t ** ) xTask;
+
+    return ( Thread_t * ) ( pxTopOfStack + 1 );
+}
+/*-----------------------------------------------------------*/
+
+#if defined( __x86_64__ )
+
+/*
+ * Save the callee-saved registers on the current stack, store the stack
+ * pointer in *ppvSave, switch to pvLoad and restore the registers saved
+ * there. Everything else is caller-saved in the System V ABI.
+ */
+    void prvSwitchStack( void ** ppvSave,
+                         void * pvLoad ) __attribute__( ( visibility( "hidden" ) ) );
+
+    __asm__ (
+        ".text\n"
+        ".globl prvSwitchStack\n"
+        ".hidden prvSwitchStack\n"
+        ".type prvSwitchStack, @function\n"
+        "prvSwitchStack:\n"
+        "    pushq %rbp\n"
+        "    pushq %rbx\n"
+        "    pushq %r12\n"
+        "    pushq %r13\n"
+        "    pushq %r14\n"
+        "    pushq %r15\n"
+        "    movq %rsp, (%rdi)\n"
+        "    movq %rsi, %rsp\n"
+        "    popq %r15\n"
+        "    popq %r14\n"
+        "    popq %r13\n"
+        "    popq %r12\n"
+        "    popq %rbx\n"
+        "    popq %rbp\n"
+        "    ret\n"
+        ".size prvSwitchStack, .-prvSwitchStack\n"
+        );
+
+#endif /* __x86_64__ */
+/*-----------------------------------------------------------*/
+
+static BaseType_t xSchedulerRunning = pdFALSE;
+static Thread_t xSchedulerContext; /* The host thread before vTaskStartScheduler(). */
+static volatile UBaseType_t uxCriticalNesting;
+static volatile BaseType_t xInterruptsDisabled = pdTRUE;
+static pthread_t hTimerTickThread;
+static BaseType_t xTimerTickThreadStarted = pdFALSE;
+static volatile bool xTimerTickThreadShouldRun;
+static uint64_t prvStartTimeNs;
+
+/* Tick source state, as in the pthread port. The tick thread owns
+ * ullTicksGenerated and ullTicksMissed and posts to ullTicksPending; the
+ * task thread processes the pending ticks at safe points. */
+static uint64_t ullTicksGenerated = 0;
+static uint64_t ullTicksMissed = 0;
+static uint64_t ullTicksPending = 0;
+static uint64_t ullTicksProcessed = 0;
+static uint64_t ullSafePointRuns = 0;
+
+/* Tickless idle: while the idle task sleeps the tick thread posts nothing
+ * until tick ullSuppressUntilTick, then hands the skipped ticks to the
+ * idle task in ullTicksToStep. Shared under xTickMutex. */
+static pthread_mutex_t xTickMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t xIdleWakeCond = PTHREAD_COND_INITIALIZER;
+static uint64_t ullSuppressUntilTick = 0;
+static uint64_t ullTicksToStep = 0;
+static uint64_t ullTicksStepped = 0;
+
+/* Tick thread wake-up latency past its deadline, under xTickMutex. */
+static uint64_t ullTickWakeups = 0;
+static uint64_t ullWakeLatencyTotalNs = 0;
+static uint64_t ullWakeLatencyMaxNs = 0;
+
+/* Simulated clock: no tick thread, only the idle task advances time. */
+static BaseType_t xSimulatedClock = pdFALSE;
+
+/* Run-time statistics counter origin, set before the scheduler starts. */
+static uint64_t ullRunTimeBaseNs = 0;
+
+/* Host scheduling of the port threads, set by iPortSetHostScheduling()
+ * before the scheduler starts. A CPU of -1 leaves a thread unpinned and a
+ * FIFO priority of 0 leaves it under SCHED_OTHER. */
+static int iHostTickCpu = -1;
+static int iHostTaskCpu = -1;
+static int iHostFifoPriority = 0;
+static size_t uxHostThreadStackSize = 0; /* 0: the pthread default. */
+/*-----------------------------------------------------------*/
+
+static void prvSetupTimerInterrupt( void );
+static void prvTaskEntry( void );
+static void prvSwitchTask( Thread_t * pxThreadToSuspend,
+                           Thread_t * pxThreadToResume );
+static void prvProcessTicks( void );
+static uint64_t prvGetTimeNs( void );
+static void prvFatalError( const char * pcCall,
+                           int iErrno ) __attribute__( ( __noreturn__ ) );
+/*-----------------------------------------------------------*/
+
+#ifdef __linux__
+
+static int prvCheckHostCpu( int iCpu,
+                            const cpu_set_t * pxAllowed )
+{
+    if( iCpu < 0 )
+    {
+        return 0;
+    }
+
+    if( ( iCpu >= CPU_SETSIZE ) || !CPU_ISSET( iCpu, pxAllowed ) )
+    {
+        return EINVAL;
+    }
+
+    return 0;
+}
+/*-----------------------------------------------------------*/
+
+/* Apply the host scheduling options to the attributes of a new port thread. */
+static void prvSetHostAttributes( pthread_attr_t * pxAttr,
+                                  int iCpu,
+                                  int iFifoPriority )
+{
+    int iRet;
+
+    if( iCpu >= 0 )
+    {
+        cpu_set_t xCpus;
+
+        CPU_ZERO( &xCpus );
+        CPU_SET( iCpu, &xCpus );
+        iRet = pthread_attr_setaffinity_np( pxAttr, sizeof( xCpus ), &xCpus );
+
+        if( iRet != 0 )
+        {
+            prvFatalError( "pthread_attr_setaffinity_np", iRet );
+        }
+    }
+
+    if( iFifoPriority > 0 )
+    {
+        struct sched_param xParam;
+
+        memset( &xParam, 0, sizeof( xParam ) );
+        xParam.sched_priority = iFifoPriority;
+        ( void ) pthread_attr_setinheritsched( pxAttr, PTHREAD_EXPLICIT_SCHED );
+        ( void ) pthread_attr_setschedpolicy( pxAttr, SCHED_FIFO );
+        ( void ) pthread_attr_setschedparam( pxAttr, &xParam );
+    }
+
+    if( uxHostThreadStackSize != 0 )
+    {
+        ( void ) pthread_attr_setstacksize( pxAttr, uxHostThreadStackSize );
+    }
+}
+
+/* The tasks run on the thread that starts the scheduler. */
+static void prvSetHostSchedulingOfSelf( void )
+{
+    if( iHostTaskCpu >= 0 )
+    {
+        cpu_set_t xCpus;
+
+        CPU_ZERO( &xCpus );
+        CPU_SET( iHostTaskCpu, &xCpus );
+        int iRet = pthread_setaffinity_np( pthread_self(), sizeof( xCpus ), &xCpus );
+
+        if( iRet != 0 )
+        {
+            prvFatalError( "pthread_setaffinity_np", iRet );
+        }
+    }
+
+    if( iHostFifoPriority > 0 )
+    {
+        struct sched_param xParam;
+
+        memset( &xParam, 0, sizeof( xParam ) );
+        xParam.sched_priority = iHostFifoPriority;
+        ( void ) pthread_setschedparam( pthread_self(), SCHED_FIFO, &xParam );
+    }
+}
+
+#else /* __linux__ */
+
+static void prvSetHostSchedulingOfSelf( void )
+{
+}
+
+static void prvSetHostAttributes( pthread_attr_t * pxAttr,
+                                  int iCpu,
+                                  int iFifoPriority )
+{
+    ( void ) pxAttr;
+    ( void ) iCpu;
+    ( void ) iFifoPriority;
+}
+
+#endif /* __linux__ */
+/*-----------------------------------------------------------*/
+
+void prvFatalError( const char * pcCall,
+                    int iErrno )
+{
+    fprintf( stderr, "%s: %s\n", pcCall, strerror( iErrno ) );
+    abort();
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * See header file for description.
+ */
+StackType_t * pxPortInitialiseStack( StackType_t * pxTopOfStack,
+                                     StackType_t * pxEndOfStack,
+                                     TaskFunction_t pxCode,
+                                     void * pvParameters )
+{
+    Thread_t * thread;
+    uintptr_t uxFrameTop;
+
+    /*
+     * Store the additional task data at the start of the stack; the task
+     * runs on the rest of it.
+     */
+    thread = ( Thread_t * ) ( pxTopOfStack + 1 ) - 1;
+    pxTopOfStack = ( StackType_t * ) thread - 1;
+    uxFrameTop = ( uintptr_t ) thread & ~( uintptr_t ) 15;
+
+    configASSERT( uxFrameTop > ( uintptr_t ) pxEndOfStack + 1024 );
+
+    thread->pxCode = pxCode;
+    thread->pvParams = pvParameters;
+
+    #if defined( __x86_64__ )
+    {
+        void ** ppvFrame = ( void ** ) uxFrameTop;
+
+        /* The first switch pops six zeroed registers and returns into
+         * prvTaskEntry() with the stack aligned as after a call. */
+        *( --ppvFrame ) = NULL; /* prvTaskEntry() never returns. */
+        *( --ppvFrame ) = ( void * ) prvTaskEntry;
+        ppvFrame -= 6;
+        memset( ppvFrame, 0, 6 * sizeof( void * ) );
+        thread->pvStackPointer = ppvFrame;
+    }
+    #else
+    {
+        if( getcontext( &thread->xContext ) != 0 )
+        {
+            prvFatalError( "getcontext", errno );
+        }
+
+        thread->xContext.uc_stack.ss_sp = pxEndOfStack;
+        thread->xContext.uc_stack.ss_size = uxFrameTop - ( uintptr_t ) pxEndOfStack;
+        thread->xContext.uc_link = NULL;
+        makecontext( &thread->xContext, prvTaskEntry, 0 );
+    }
+    #endif /* __x86_64__ */
+
+    return pxTopOfStack;
+}
+/*-----------------------------------------------------------*/
+
+static void prvTaskEntry( void )
+{
+    Thread_t * pxThread = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+
+    /* Resumed for the first time, enable interrupts. */
+    uxCriticalNesting = 0;
+    vPortEnableInterrupts();
+
+    /* Call the task's entry point. */
+    pxThread->pxCode( pxThread->pvParams );
+
+    /* A function that implements a task must not exit or attempt to return to
+     * its caller as there is nothing to return to. If a task wants to exit it
+     * should instead call vTaskDelete( NULL ). Artificially force an assert()
+     * to be triggered if configASSERT() is defined, so application writers can
+     * catch the error. */
+    configASSERT( pdFALSE );
+}
+/*-----------------------------------------------------------*/
+
+static void prvSwitchTask( Thread_t * pxThreadToSuspend,
+                           Thread_t * pxThreadToResume )
+{
+    UBaseType_t uxSavedCriticalNesting;
+
+    if( pxThreadToSuspend != pxThreadToResume )
+    {
+        /* The critical section nesting is per-task; keep it on the stack
+         * of the suspending task until it is resumed. */
+        uxSavedCriticalNesting = uxCriticalNesting;
+
+        #if defined( __x86_64__ )
+            prvSwitchStack( &pxThreadToSuspend->pvStackPointer, pxThreadToResume->pvStackPointer );
+        #else
+            if( swapcontext( &pxThreadToSuspend->xContext, &pxThreadToResume->xContext ) != 0 )
+            {
+                prvFatalError( "swapcontext", errno );
+            }
+        #endif
+
+        uxCriticalNesting = uxSavedCriticalNesting;
+    }
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * See header file for description.
+ */
+BaseType_t xPortStartScheduler( void )
+{
+    prvSetHostSchedulingOfSelf();
+
+    /* Interrupts are disabled here already. A simulated clock has no tick
+     * source; the idle task advances time. */
+    if( xSimulatedClock == pdFALSE )
+    {
+        prvSetupTimerInterrupt();
+    }
+    else
+    {
+        prvStartTimeNs = prvGetTimeNs();
+    }
+
+    /* Run the tasks on this thread until vPortEndScheduler() switches
+     * back here. */
+    xSchedulerRunning = pdTRUE;
+    prvSwitchTask( &xSchedulerContext, prvGetThreadFromTask( xTaskGetCurrentTaskHandle() ) );
+    xSchedulerRunning = pdFALSE;
+
+    return 0;
+}
+/*-----------------------------------------------------------*/
+
+void vPortEndScheduler( void )
+{
+    /* Stop the timer tick thread. */
+    xTimerTickThreadShouldRun = false;
+
+    if( xTimerTickThreadStarted == pdTRUE )
+    {
+        pthread_mutex_lock( &xTickMutex );
+        pthread_cond_signal( &xIdleWakeCond );
+        pthread_mutex_unlock( &xTickMutex );
+        pthread_join( hTimerTickThread, NULL );
+        xTimerTickThreadStarted = pdFALSE;
+    }
+
+    /* Return from xPortStartScheduler(); the calling task is abandoned. */
+    prvSwitchTask( prvGetThreadFromTask( xTaskGetCurrentTaskHandle() ), &xSchedulerContext );
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnterCritical( void )
+{
+    if( uxCriticalNesting == 0 )
+    {
+        vPortDisableInterrupts();
+    }
+
+    uxCriticalNesting++;
+}
+/*-----------------------------------------------------------*/
+
+void vPortExitCritical( void )
+{
+    uxCriticalNesting--;
+
+    /* If we have reached 0 then re-enable the interrupts. */
+    if( uxCriticalNesting == 0 )
+    {
+        vPortEnableInterrupts();
+    }
+}
+/*-----------------------------------------------------------*/
+
+void vPortYield( void )
+{
+    Thread_t * pxThreadToSuspend;
+    Thread_t * pxThreadToResume;
+
+    vPortEnterCritical();
+
+    pxThreadToSuspend = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+
+    vTaskSwitchContext();
+
+    pxThreadToResume = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+
+    prvSwitchTask( pxThreadToSuspend, pxThreadToResume );
+
+    vPortExitCritical();
+}
+/*-----------------------------------------------------------*/
+
+void vPortDisableInterrupts( void )
+{
+    xInterruptsDisabled = pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnableInterrupts( void )
+{
+    xInterruptsDisabled = pdFALSE;
+
+    /* Safe point: process the ticks the tick thread posted meanwhile. */
+    if( ( xSchedulerRunning == pdTRUE ) &&
+        ( __atomic_load_n( &ullTicksPending, __ATOMIC_RELAXED ) != 0 ) )
+    {
+        ullSafePointRuns++;
+        prvProcessTicks();
+    }
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t xPortSetInterruptMask( void )
+{
+    /* There are no real interrupts; ticks are processed at safe points. */
+    return ( UBaseType_t ) 0;
+}
+/*-----------------------------------------------------------*/
+
+void vPortClearInterruptMask( UBaseType_t uxMask )
+{
+    ( void ) uxMask;
+}
+/*-----------------------------------------------------------*/
+
+static void prvProcessTicks( void )
+{
+    Thread_t * pxThreadToSuspend;
+    Thread_t * pxThreadToResume;
+    BaseType_t xSwitchRequired = pdFALSE;
+    uint64_t ullTicks;
+
+    xInterruptsDisabled = pdTRUE;
+    uxCriticalNesting++;
+
+    pxThreadToSuspend = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+
+    ullTicks = __atomic_exchange_n( &ullTicksPending, 0, __ATOMIC_ACQUIRE );
+    ullTicksProcessed += ullTicks;
+
+    while( ullTicks > 0 )
+    {
+        if( xTaskIncrementTick() != pdFALSE )
+        {
+            xSwitchRequired = pdTRUE;
+        }
+
+        ullTicks--;
+    }
+
+    if( xSwitchRequired != pdFALSE )
+    {
+        /* Select Next Task. */
+        vTaskSwitchContext();
+
+        pxThreadToResume = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+
+        prvSwitchTask( pxThreadToSuspend, pxThreadToResume );
+    }
+
+    uxCriticalNesting--;
+    xInterruptsDisabled = pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+static uint64_t prvGetTimeNs( void )
+{
+    struct timespec t;
+
+    clock_gettime( CLOCK_MONOTONIC, &t );
+
+    return ( uint64_t ) t.tv_sec * ( uint64_t ) 1000000000UL + ( uint64_t ) t.tv_nsec;
+}
+/*-----------------------------------------------------------*/
+
+/* Sleep until an absolute CLOCK_MONOTONIC time in nanoseconds. */
+static void prvSleepUntilNs( uint64_t ullDeadlineNs )
+{
+    #ifdef __APPLE__
+        uint64_t ullNowNs = prvGetTimeNs();
+
+        while( ullNowNs < ullDeadlineNs )
+        {
+            struct timespec xDelay;
+            xDelay.tv_sec = ( time_t ) ( ( ullDeadlineNs - ullNowNs ) / 1000000000ULL );
+            xDelay.tv_nsec = ( long ) ( ( ullDeadlineNs - ullNowNs ) % 1000000000ULL );
+            nanosleep( &xDelay, NULL );
+            ullNowNs = prvGetTimeNs();
+        }
+    #else
+        struct timespec xDeadline;
+
+        xDeadline.tv_sec = ( time_t ) ( ullDeadlineNs / 1000000000ULL );
+        xDeadline.tv_nsec = ( long ) ( ullDeadlineNs % 1000000000ULL );
+
+        while( clock_nanosleep( CLOCK_MONOTONIC, TIMER_ABSTIME, &xDeadline, NULL ) == EINTR )
+        {
+        }
+    #endif
+}
+/*-----------------------------------------------------------*/
+
+static void * prvTimerTickHandler( void * arg )
+{
+    const uint64_t ullTickPeriodNs = ( uint64_t ) portTICK_RATE_MICROSECONDS * 1000ULL;
+
+    ( void ) arg;
+
+    while( xTimerTickThreadShouldRun )
+    {
+        uint64_t ullDue;
+        uint64_t ullNextTick;
+        uint64_t ullDeadlineNs;
+        uint64_t ullNowNs;
+        uint64_t ullLateNs;
+
+        /* Tick n is due at prvStartTimeNs + n periods; while the idle task
+         * sleeps, sleep straight to its wake-up tick. */
+        pthread_mutex_lock( &xTickMutex );
+        ullNextTick = ullTicksGenerated + 1;
+
+        if( ullSuppressUntilTick > ullNextTick )
+        {
+            ullNextTick = ullSuppressUntilTick;
+        }
+
+        pthread_mutex_unlock( &xTickMutex );
+
+        ullDeadlineNs = prvStartTimeNs + ullNextTick * ullTickPeriodNs;
+        prvSleepUntilNs( ullDeadlineNs );
+
+        ullNowNs = prvGetTimeNs();
+        ullDue = ( ullNowNs - prvStartTimeNs ) / ullTickPeriodNs;
+
+        pthread_mutex_lock( &xTickMutex );
+
+        ullLateNs = ( ullNowNs > ullDeadlineNs ) ? ullNowNs - ullDeadlineNs : 0;
+        ullTickWakeups++;
+        ullWakeLatencyTotalNs += ullLateNs;
+
+        if( ullLateNs > ullWakeLatencyMaxNs )
+        {
+            ullWakeLatencyMaxNs = ullLateNs;
+        }
+
+        if( ullSuppressUntilTick != 0 )
+        {
+            if( ullDue < ullSuppressUntilTick )
+            {
+                /* Idle started sleeping after this wake-up was scheduled;
+                 * hold the ticks back for the step. */
+                pthread_mutex_unlock( &xTickMutex );
+                continue;
+            }
+
+            ullTicksToStep = ullSuppressUntilTick - ullTicksGenerated;
+            ullTicksGenerated = ullSuppressUntilTick;
+            ullSuppressUntilTick = 0;
+            pthread_cond_signal( &xIdleWakeCond );
+        }
+
+        if( ullDue > ullTicksGenerated )
+        {
+            /* Late wake-ups are compensated, not lost. */
+            ullTicksMissed += ullDue - ullTicksGenerated - 1;
+            __atomic_add_fetch( &ullTicksPending, ullDue - ullTicksGenerated, __ATOMIC_RELEASE );
+            ullTicksGenerated = ullDue;
+        }
+
+        pthread_mutex_unlock( &xTickMutex );
+    }
+
+    return NULL;
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Start the thread that generates the ticks at the required frequency.
+ */
+void prvSetupTimerInterrupt( void )
+{
+    pthread_attr_t xThreadAttributes;
+    int iRet;
+
+    /* The tick thread computes its deadlines from the start time. */
+    prvStartTimeNs = prvGetTimeNs();
+
+    xTimerTickThreadShouldRun = true;
+
+    pthread_attr_init( &xThreadAttributes );
+    prvSetHostAttributes( &xThreadAttributes, iHostTickCpu,
+                          ( iHostFifoPriority > 0 ) ? iHostFifoPriority + 1 : 0 );
+    iRet = pthread_create( &hTimerTickThread, &xThreadAttributes, prvTimerTickHandler, NULL );
+    pthread_attr_destroy( &xThreadAttributes );
+
+    if( iRet != 0 )
+    {
+        prvFatalError( "pthread_create", iRet );
+    }
+
+    xTimerTickThreadStarted = pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime )
+{
+    uint64_t ullStep;
+
+    if( xSimulatedClock == pdTRUE )
+    {
+        /* Every task is blocked: jump to the next unblock time. Nothing can
+         * wake a system whose tasks all wait without a timeout, so the
+         * clock is left to the idle hook in that case. */
+        if( ( eTaskConfirmSleepModeStatus() == eStandardSleep ) &&
+            ( ( TickType_t ) ( xTaskGetTickCount() + xExpectedIdleTime ) != portMAX_DELAY ) )
+        {
+            ullTicksStepped += xExpectedIdleTime;
+            vTaskStepTick( xExpectedIdleTime );
+        }
+
+        return;
+    }
+
+    /* Called by the idle task with the scheduler suspended. */
+    vPortDisableInterrupts();
+    pthread_mutex_lock( &xTickMutex );
+
+    /* A tick that is posted but not yet processed means the kernel's tick
+     * count lags the tick thread; let it be processed first. */
+    if( ( eTaskConfirmSleepModeStatus() == eAbortSleep ) ||
+        ( __atomic_load_n( &ullTicksPending, __ATOMIC_ACQUIRE ) != 0 ) )
+    {
+        pthread_mutex_unlock( &xTickMutex );
+        vPortEnableInterrupts();
+        return;
+    }
+
+    ullSuppressUntilTick = ullTicksGenerated + xExpectedIdleTime;
+
+    while( ( ullSuppressUntilTick != 0 ) && xTimerTickThreadShouldRun )
+    {
+        pthread_cond_wait( &xIdleWakeCond, &xTickMutex );
+    }
+
+    ullStep = ullTicksToStep;
+    ullTicksToStep = 0;
+    ullSuppressUntilTick = 0;
+    ullTicksStepped += ullStep;
+    pthread_mutex_unlock( &xTickMutex );
+
+    /* Reaching the unblock time pends the final tick, which
+     * xTaskResumeAll() processes after this returns. */
+    if( ullStep > 0 )
+    {
+        vTaskStepTick( ( TickType_t ) ullStep );
+    }
+
+    vPortEnableInterrupts();
+}
+/*-----------------------------------------------------------*/
+
+void vPortSetSimulatedClock( BaseType_t xEnable )
+{
+    /* Set before the scheduler starts. */
+    xSimulatedClock = xEnable;
+}
+/*-----------------------------------------------------------*/
+
+void vPortIdleHook( void )
+{
+    if( xSimulatedClock == pdTRUE )
+    {
+        /* Tickless idle only steps gaps of configEXPECTED_IDLE_TIME_BEFORE_SLEEP
+         * ticks or more; advance the remaining single ticks here. */
+        ullTicksProcessed++;
+        ( void ) xTaskCatchUpTicks( 1 );
+    }
+    else if( __atomic_load_n( &ullTicksPending, __ATOMIC_RELAXED ) != 0 )
+    {
+        /* The idle loop makes no kernel calls while it waits for a single
+         * tick, so it is a safe point of its own. */
+        ullSafePointRuns++;
+        prvProcessTicks();
+    }
+}
+/*-----------------------------------------------------------*/
+
+void vPortSetTickSafePoints( BaseType_t xEnable )
+{
+    /* Ticks are always processed at safe points in this port. */
+    ( void ) xEnable;
+}
+/*-----------------------------------------------------------*/
+
+void vPortSetSwitchSpin( uint32_t ulSpinCount )
+{
+    /* Switching never waits for another thread in this port. */
+    ( void ) ulSpinCount;
+}
+/*-----------------------------------------------------------*/
+
+void vPortGetTickStats( PortTickStats_t * pxStats )
+{
+    pthread_mutex_lock( &xTickMutex );
+    pxStats->ullGenerated = ( xSimulatedClock == pdTRUE ) ? ullTicksProcessed + ullTicksStepped : ullTicksGenerated;
+    pxStats->xSimulated = xSimulatedClock;
+    pxStats->ullMissed = ullTicksMissed;
+    pxStats->ullSignals = 0;
+    pxStats->ullStepped = ullTicksStepped;
+    pxStats->ullWakeups = ullTickWakeups;
+    pxStats->ullWakeLatencyNs = ullWakeLatencyTotalNs;
+    pxStats->ullMaxWakeLatencyNs = ullWakeLatencyMaxNs;
+    pthread_mutex_unlock( &xTickMutex );
+    pxStats->ullProcessed = ullTicksProcessed;
+    pxStats->ullDeferred = 0;
+    pxStats->ullSafePointRuns = ullSafePointRuns;
+    pxStats->ullElapsedNs = prvGetTimeNs() - prvStartTimeNs;
+}
+/*-----------------------------------------------------------*/
+
+int iPortSetHostScheduling( const PortHostScheduling_t * pxConfig )
+{
+    #ifdef __linux__
+        cpu_set_t xAllowed;
+        int iRet;
+
+        /* Only CPUs in the process's affinity mask can be used. */
+        if( sched_getaffinity( 0, sizeof( xAllowed ), &xAllowed ) != 0 )
+        {
+            return errno;
+        }
+
+        iRet = prvCheckHostCpu( pxConfig->iTickCpu, &xAllowed );
+
+        if( iRet == 0 )
+        {
+            iRet = prvCheckHostCpu( pxConfig->iTaskCpu, &xAllowed );
+        }
+
+        if( iRet != 0 )
+        {
+            return iRet;
+        }
+
+        if( pxConfig->iFifoPriority != 0 )
+        {
+            int iPolicy;
+            struct sched_param xSaved;
+            struct sched_param xParam;
+
+            /* The tick thread runs one priority above the tasks. */
+            if( ( pxConfig->iFifoPriority < sched_get_priority_min( SCHED_FIFO ) ) ||
+                ( pxConfig->iFifoPriority + 1 > sched_get_priority_max( SCHED_FIFO ) ) )
+            {
+                return EINVAL;
+            }
+
+            /* Threads are created long after this call; check the
+             * privilege here, on the calling thread, and restore it. */
+            ( void ) pthread_getschedparam( pthread_self(), &iPolicy, &xSaved );
+            memset( &xParam, 0, sizeof( xParam ) );
+            xParam.sched_priority = pxConfig->iFifoPriority + 1;
+            iRet = pthread_setschedparam( pthread_self(), SCHED_FIFO, &xParam );
+
+            if( iRet != 0 )
+            {
+                return iRet;
+            }
+
+            ( void ) pthread_setschedparam( pthread_self(), iPolicy, &xSaved );
+        }
+
+        if( pxConfig->xLockMemory == pdTRUE )
+        {
+            /* MCL_FUTURE locks every later mapping in full, thread stacks
+             * included, so the port's threads get smaller stacks. */
+            if( mlockall( MCL_CURRENT | MCL_FUTURE ) != 0 )
+            {
+                return errno;
+            }
+
+            uxHostThreadStackSize = LOCKED_THREAD_STACK_SIZE;
+        }
+
+        iHostTickCpu = pxConfig->iTickCpu;
+        iHostTaskCpu = pxConfig->iTaskCpu;
+        iHostFifoPriority = pxConfig->iFifoPriority;
+
+        return 0;
+    #else /* __linux__ */
+        ( void ) pxConfig;
+
+        return ENOTSUP;
+    #endif /* __linux__ */
+}
+/*-----------------------------------------------------------*/
+
+void vPortConfigureRunTimeCounter( void )
+{
+    ullRunTimeBaseNs = prvGetTimeNs();
+}
+/*-----------------------------------------------------------*/
+
+uint64_t ullPortGetRunTimeCounter( void )
+{
+    /* Read on every context switch; CLOCK_MONOTONIC is a vDSO call. */
+    return prvGetTimeNs() - ullRunTimeBaseNs;
+}
+/*-----------------------------------------------------------*/
@@ -0,0 +1,224 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright 2020 Cambridge Consultants Ltd.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+
+#ifndef PORTMACRO_H
+#define PORTMACRO_H
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+#include <limits.h>
+#include <stdint.h>
+
+/*-----------------------------------------------------------
+ * Port specific definitions.
+ *
+ * The settings in this file configure FreeRTOS correctly for the
+ * given hardware and compiler.
+ *
+ * These settings should not be altered.
+ *-----------------------------------------------------------
+ */
+
+/* Type definitions. */
+#define portCHAR                 char
+#define portFLOAT                float
+#define portDOUBLE               double
+#define portLONG                 long
+#define portSHORT                short
+#define portSTACK_TYPE           unsigned long
+#define portBASE_TYPE            long
+#define portPOINTER_SIZE_TYPE    intptr_t
+
+typedef portSTACK_TYPE   StackType_t;
+typedef long             BaseType_t;
+typedef unsigned long    UBaseType_t;
+
+typedef unsigned long    TickType_t;
+#define portMAX_DELAY              ( ( TickType_t ) ULONG_MAX )
+
+#define portTICK_TYPE_IS_ATOMIC    1
+
+/*-----------------------------------------------------------*/
+
+/* Architecture specifics. */
+#define portSTACK_GROWTH                   ( -1 )
+#define portHAS_STACK_OVERFLOW_CHECKING    ( 1 )
+#define portTICK_PERIOD_MS                 ( ( TickType_t ) 1000 / configTICK_RATE_HZ )
+#define portTICK_RATE_MICROSECONDS         ( ( TickType_t ) 1000000 / configTICK_RATE_HZ )
+#define portBYTE_ALIGNMENT                 8
+/*-----------------------------------------------------------*/
+
+/* Port optimised task selection: the ready priorities are kept as a bit map
+ * in uxTopReadyPriority and the highest one is found with a count leading
+ * zeros instruction, so selection takes constant time whatever the number of
+ * priorities, up to one per bit of UBaseType_t. */
+#if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 1 )
+
+    #define portMAX_OPTIMISED_PRIORITIES    ( __SIZEOF_LONG__ * 8 )
+
+    /* Check the configuration. */
+    #if ( configMAX_PRIORITIES > portMAX_OPTIMISED_PRIORITIES )
+        #error configUSE_PORT_OPTIMISED_TASK_SELECTION can only be set to 1 when configMAX_PRIORITIES fits in the bits of UBaseType_t.
+    #endif
+
+    /* Store/clear the ready priorities in a bit map. */
+    #define portRECORD_READY_PRIORITY( uxPriority, uxReadyPriorities )    ( uxReadyPriorities ) |= ( ( ( UBaseType_t ) 1 ) << ( uxPriority ) )
+    #define portRESET_READY_PRIORITY( uxPriority, uxReadyPriorities )     ( uxReadyPriorities ) &= ~( ( ( UBaseType_t ) 1 ) << ( uxPriority ) )
+
+    /* The idle task is always ready, so the bit map is never zero here. */
+    #define portGET_HIGHEST_PRIORITY( uxTopPriority, uxReadyPriorities ) \
+    uxTopPriority = ( UBaseType_t ) ( portMAX_OPTIMISED_PRIORITIES - 1 ) - ( UBaseType_t ) __builtin_clzl( ( uxReadyPriorities ) )
+
+#endif /* configUSE_PORT_OPTIMISED_TASK_SELECTION */
+/*-----------------------------------------------------------*/
+
+/* Scheduler utilities. */
+extern void vPortYield( void );
+
+#define portYIELD()                vPortYield()
+
+#define portEND_SWITCHING_ISR( xSwitchRequired ) \
+    do                                           \
+    {                                            \
+        if( xSwitchRequired != pdFALSE )         \
+        {                                        \
+            traceISR_EXIT_TO_SCHEDULER();        \
+            vPortYield();                        \
+        }                                        \
+        else                                     \
+        {                                        \
+            traceISR_EXIT();                     \
+        }                                        \
+    } while( 0 )
+#define portYIELD_FROM_ISR( x )    portEND_SWITCHING_ISR( x )
+/*-----------------------------------------------------------*/
+
+/* Critical section management. */
+extern void vPortDisableInterrupts( void );
+extern void vPortEnableInterrupts( void );
+#define portSET_INTERRUPT_MASK()      ( vPortDisableInterrupts() )
+#define portCLEAR_INTERRUPT_MASK()    ( vPortEnableInterrupts() )
+
+extern UBaseType_t xPortSetInterruptMask( void );
+extern void vPortClearInterruptMask( UBaseType_t xMask );
+
+extern void vPortEnterCritical( void );
+extern void vPortExitCritical( void );
+#define portSET_INTERRUPT_MASK_FROM_ISR()         xPortSetInterruptMask()
+#define portCLEAR_INTERRUPT_MASK_FROM_ISR( x )    vPortClearInterruptMask( x )
+#define portDISABLE_INTERRUPTS()                  portSET_INTERRUPT_MASK()
+#define portENABLE_INTERRUPTS()                   portCLEAR_INTERRUPT_MASK()
+#define portENTER_CRITICAL()                      vPortEnterCritical()
+#define portEXIT_CRITICAL()                       vPortExitCritical()
+
+/*-----------------------------------------------------------*/
+
+#define portTASK_FUNCTION_PROTO( vFunction, pvParameters )         void vFunction( void * pvParameters ) __attribute__( ( noreturn ) )
+#define portTASK_FUNCTION( vFunction, pvParameters )               void vFunction( void * pvParameters )
+/*-----------------------------------------------------------*/
+
+/*
+ * All tasks run on one host thread and the tick is only processed at
+ * safe points on that thread, so a compiler barrier is enough to
+ * prevent reordering.
+ */
+#define portMEMORY_BARRIER()                        __asm volatile ( "" ::: "memory" )
+
+/* Tickless idle: the idle task sleeps until the next unblock time and the
+ * skipped ticks are stepped on wake-up. */
+extern void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime );
+#define portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime )    vPortSuppressTicksAndSleep( xExpectedIdleTime )
+
+/* Tick source statistics. */
+typedef struct PORT_TICK_STATS
+{
+    uint64_t ullGenerated; /* Ticks elapsed on the tick thread's timeline. */
+    uint64_t ullMissed;    /* Ticks found overdue (delivered late, not lost). */
+    uint64_t ullSignals;   /* Always 0: this port sends no signals. */
+    uint64_t ullProcessed; /* Ticks processed by the tick handler. */
+    uint64_t ullStepped;   /* Ticks skipped in tickless idle and stepped. */
+    uint64_t ullDeferred;  /* Always 0: this port sends no signals. */
+    uint64_t ullSafePointRuns; /* Pending ticks processed on enabling interrupts. */
+    uint64_t ullWakeups;   /* Tick thread wake-ups. */
+    uint64_t ullWakeLatencyNs;    /* Total wake-up latency past the deadlines. */
+    uint64_t ullMaxWakeLatencyNs; /* Worst wake-up latency. */
+    uint64_t ullElapsedNs; /* Time since the scheduler started. */
+    BaseType_t xSimulated; /* Ticks advance only while all tasks are blocked. */
+} PortTickStats_t;
+
+extern void vPortGetTickStats( PortTickStats_t * pxStats );
+
+/* Ticks are always delivered at safe points in this port; kept for source
+ * compatibility with the pthread port. */
+extern void vPortSetTickSafePoints( BaseType_t xEnable );
+
+/* Simulated clock: no tick source, the tick count jumps to the next unblock
+ * time whenever every task is blocked. vPortIdleHook() must be called from
+ * the application idle hook. */
+extern void vPortSetSimulatedClock( BaseType_t xEnable );
+extern void vPortIdleHook( void );
+
+/* No thread hand-off to spin on in this port; kept for source
+ * compatibility with the pthread port. */
+extern void vPortSetSwitchSpin( uint32_t ulSpinCount );
+
+/* Host scheduling of the port threads, set before the scheduler starts.
+ * The tick thread and the task threads are pinned to one CPU each (-1: not
+ * pinned) and optionally run under SCHED_FIFO at iFifoPriority, the tick
+ * thread one priority higher (0: SCHED_OTHER). xLockMemory locks all
+ * current and future memory with mlockall(). Returns 0 or an errno value;
+ * Linux only. */
+typedef struct PORT_HOST_SCHEDULING
+{
+    int iTickCpu;
+    int iTaskCpu;
+    int iFifoPriority;
+    BaseType_t xLockMemory;
+} PortHostScheduling_t;
+
+extern int iPortSetHostScheduling( const PortHostScheduling_t * pxConfig );
+
+/* Run-time statistics: a 64-bit count of CLOCK_MONOTONIC nanoseconds since
+ * the scheduler was started (configRUN_TIME_COUNTER_TYPE must be uint64_t). */
+extern void vPortConfigureRunTimeCounter( void );
+extern uint64_t ullPortGetRunTimeCounter( void );
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()    vPortConfigureRunTimeCounter()
+#define portGET_RUN_TIME_COUNTER_VALUE()            ullPortGetRunTimeCounter()
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* PORTMACRO_H */
@@ -0,0 +1,331 @@
+// Scheduler temel islemleri icin mikro benchmark
+//
+// queue_add (kuyruk sonuna ve rastgele araya), queue_remove, find_highest_priority_queue,
+// check_arriving_tasks ve check_timeouts fonksiyonlarini 10^2..10^6 gorev ile olcer. Her olcum once isinma
+// turlariyla, sonra tekrarli olarak calistirilir; sonuclar JSON olarak yazilir.
+// FreeRTOS baslatilmaz: fonksiyonlar dogrudan, simulasyonun kullandigi global
+// durum uzerinde cagrilir.
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <time.h>
+#include <unistd.h>
+
+#include "scheduler.h"
+
+#define BENCH_DEFAULT_REPS      5
+#define BENCH_DEFAULT_WARMUP    1
+#define BENCH_DEFAULT_MAX_TASKS 1000000
+#define BENCH_QUEUE_OPS         1000        // Kuyruk islemleri: N boyutlu kuyrukta olculen islem sayisi
+#define BENCH_LOOKUP_OPS        1000000     // Sabit maliyetli cagrilar icin islem sayisi
+#define BENCH_ARRIVALS_PER_SEC  4           // check_arriving_tasks: saniyede gelen gorev
+#define BENCH_MIN_OPS           10000       // Kisa olcumler bu islem sayisina veya
+#define BENCH_MIN_NS            20000000LL  // bu sureye ulasana kadar tekrarlanir
+#define BENCH_MAX_REPS          100
+
+// Simulasyonun global durumu (normalde main.c'de tanimlanir)
+const char* COLOR_PALETTE[COLOR_PALETTE_SIZE] = { "" };
+TaskInfo* g_tasks = NULL;
+int g_task_capacity = 0;
+int g_task_count = 0;
+int g_completed_tasks = 0;
+int g_current_time = 0;
+int g_context_switches = 0;
+int g_fast_mode = 1;
+int g_sim_clock = 0;
+DynamicQueue g_priority_queues[MAX_PRIORITY_LEVEL];
+
+// Olcum fonksiyonu: hazirlik disinda kalan sureyi ns olarak ve islem sayisini doner
+typedef long long (*BenchFunc)(int tasks, long long* ops);
+
+typedef struct {
+    const char* name;
+    BenchFunc run;
+    const char* note;           // JSON'a yazilan olcum notu (NULL: yok)
+} BenchCase;
+
+static volatile int s_sink;     // Derleyicinin cagrilari silmesini engeller
+static unsigned int s_rng = 1;  // Ara ekleme konumlari icin sabit tohumlu xorshift
+
+static unsigned int bench_rand(void) {
+    s_rng ^= s_rng << 13;
+    s_rng ^= s_rng >> 17;
+    s_rng ^= s_rng << 5;
+    return s_rng;
+}
+
+static long long bench_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+static int bench_min(int a, int b) {
+    return a < b ? a : b;
+}
+
+// Gorevleri ve kuyruklari bastan kur: gorev i, i/rate zamaninda gelir
+static void bench_reset_tasks(int count, int arrivals_per_sec) {
+    init_queues();
+    g_task_count = count;
+    g_completed_tasks = 0;
+    g_current_time = 0;
+    for (int i = 0; i < count; i++) {
+        int priority = 1 + i % 3;   // Kullanici seviyelerine dagit
+        task_init(&g_tasks[i], i, i / arrivals_per_sec, priority, 4);
+    }
+    scheduler_rebuild_indexes();
+}
+
+// Tum gorevleri hazir olarak kuyruga ekle (son aktif zaman = indeks)
+static void bench_fill_queue(int priority, int count) {
+    for (int i = 0; i < count; i++) {
+        TaskInfo* task = &g_tasks[i];
+        task->state = TASK_STATE_READY;
+        task->current_priority = priority;
+        task->last_active_time = i;
+        queue_add(priority, task);
+    }
+}
+
+// N gorevli kuyrugun sonuna ekleme (varis sirasindaki normal durum)
+static long long bench_queue_add(int tasks, long long* ops) {
+    int extra = BENCH_QUEUE_OPS;
+    bench_reset_tasks(tasks + extra, 1);
+    bench_fill_queue(PRIORITY_MEDIUM, tasks);
+    for (int i = tasks; i < tasks + extra; i++) {
+        g_tasks[i].state = TASK_STATE_READY;
+        g_tasks[i].current_priority = PRIORITY_MEDIUM;
+        g_tasks[i].last_active_time = i;
+    }
+
+    long long start = bench_now_ns();
+    for (int i = tasks; i < tasks + extra; i++) {
+        queue_add(PRIORITY_MEDIUM, &g_tasks[i]);
+    }
+    long long elapsed = bench_now_ns() - start;
+
+    *ops = extra;
+    return elapsed;
+}
+
+// N gorevli kuyrugun rastgele bir yerine ekleme (ortalama N/2 kaydirma, preempt edilip
+// eski last_active_time ile geri donen gorevlerin durumu)
+static long long bench_queue_add_mid(int tasks, long long* ops) {
+    int extra = BENCH_QUEUE_OPS;
+    bench_reset_tasks(tasks + extra, 1);
+    bench_fill_queue(PRIORITY_MEDIUM, tasks);
+    for (int i = tasks; i < tasks + extra; i++) {
+        g_tasks[i].state = TASK_STATE_READY;
+        g_tasks[i].current_priority = PRIORITY_MEDIUM;
+        g_tasks[i].last_active_time = (int)(bench_rand() % (unsigned int)tasks);
+    }
+
+    long long start = bench_now_ns();
+    for (int i = tasks; i < tasks + extra; i++) {
+        queue_add(PRIORITY_MEDIUM, &g_tasks[i]);
+    }
+    long long elapsed = bench_now_ns() - start;
+
+    *ops = extra;
+    return elapsed;
+}
+
+// N gorevli kuyrugun basindan alma
+static long long bench_queue_remove(int tasks, long long* ops) {
+    int count = bench_min(tasks, BENCH_QUEUE_OPS);
+    bench_reset_tasks(tasks, 1);
+    bench_fill_queue(PRIORITY_MEDIUM, tasks);
+
+    long long start = bench_now_ns();
+    for (int i = 0; i < count; i++) {
+        TaskInfo* task = queue_remove(PRIORITY_MEDIUM);
+        s_sink = task->task_id;
+    }
+    long long elapsed = bench_now_ns() - start;
+
+    *ops = count;
+    return elapsed;
+}
+
+// En kotu durum: sadece en dusuk oncelikli kuyruk dolu
+static long long bench_find_highest(int tasks, long long* ops) {
+    bench_reset_tasks(tasks, 1);
+    bench_fill_queue(PRIORITY_LOW, tasks);
+
+    long long start = bench_now_ns();
+    for (int i = 0; i < BENCH_LOOKUP_OPS; i++) {
+        s_sink = find_highest_priority_queue();
+    }
+    long long elapsed = bench_now_ns() - start;
+
+    *ops = BENCH_LOOKUP_OPS;
+    return elapsed;
+}
+
+// Simulasyon saniyesi basina bir cagri; her saniye BENCH_ARRIVALS_PER_SEC gorev gelir
+static long long bench_check_arriving(int tasks, long long* ops) {
+    bench_reset_tasks(tasks, BENCH_ARRIVALS_PER_SEC);
+    int steps = (tasks + BENCH_ARRIVALS_PER_SEC - 1) / BENCH_ARRIVALS_PER_SEC;
+
+    long long start = bench_now_ns();
+    for (int t = 0; t < steps; t++) {
+        g_current_time = t;
+        check_arriving_tasks();
+    }
+    long long elapsed = bench_now_ns() - start;
+
+    *ops = steps;
+    return elapsed;
+}
+
+// Kararli durum: N hazir gorev, hicbiri zaman asimina ugramiyor
+static long long bench_check_timeouts(int tasks, long long* ops) {
+    bench_reset_tasks(tasks, tasks);    // Hepsi t=0'da gelir
+    check_arriving_tasks();
+    g_current_time = MAX_TASK_TIME - 1;
+
+    long long start = bench_now_ns();
+    for (int i = 0; i < BENCH_LOOKUP_OPS; i++) {
+        check_timeouts();
+    }
+    long long elapsed = bench_now_ns() - start;
+
+    *ops = BENCH_LOOKUP_OPS;
+    return elapsed;
+}
+
+// Toplu zaman asimi: N hazir gorev ayni cagrida sonlanir (islem = sonlanan gorev)
+static long long bench_check_timeouts_expire(int tasks, long long* ops) {
+    bench_reset_tasks(tasks, tasks);
+    check_arriving_tasks();
+    g_current_time = MAX_TASK_TIME;
+
+    long long start = bench_now_ns();
+    check_timeouts();
+    long long elapsed = bench_now_ns() - start;
+
+    *ops = g_completed_tasks;
+    return elapsed;
+}
+
+static const BenchCase BENCH_CASES[] = {
+    { "queue_add",                   bench_queue_add,             "kuyruk sonuna ekleme (en iyi durum)" },
+    { "queue_add_mid",               bench_queue_add_mid,         "rastgele konuma ekleme" },
+    { "queue_remove",                bench_queue_remove,          NULL },
+    { "find_highest_priority_queue", bench_find_highest,          NULL },
+    { "check_arriving_tasks",        bench_check_arriving,        NULL },
+    { "check_timeouts",              bench_check_timeouts,        NULL },
+    { "check_timeouts_expire",       bench_check_timeouts_expire,
+      "sonlanan her gorev icin /dev/null'a yazilan zamanasimi satiri dahil; sure cogunlukla printf" },
+};
+#define BENCH_CASE_COUNT (int)(sizeof(BENCH_CASES) / sizeof(BENCH_CASES[0]))
+
+static int compare_double(const void* a, const void* b) {
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+// Tek tekrar: kisa olcumler yeterli islem veya sure birikene kadar tekrarlanir
+static double bench_sample(const BenchCase* bench, int tasks, long long* ops) {
+    long long elapsed = 0;
+    long long total_ops = 0;
+    while (total_ops < BENCH_MIN_OPS && elapsed < BENCH_MIN_NS) {
+        long long round_ops = 0;
+        elapsed += bench->run(tasks, &round_ops);
+        if (round_ops <= 0) break;
+        total_ops += round_ops;
+    }
+    *ops = total_ops;
+    return total_ops > 0 ? (double)elapsed / (double)total_ops : 0.0;
+}
+
+static void print_usage(const char* program) {
+    printf("Kullanim: %s [secenekler]\n", program);
+    printf("Secenekler:\n");
+    printf("  --reps <n>         Olcum tekrari (varsayilan: %d)\n", BENCH_DEFAULT_REPS);
+    printf("  --warmup <n>       Isinma turu (varsayilan: %d)\n", BENCH_DEFAULT_WARMUP);
+    printf("  --max-tasks <n>    En buyuk gorev sayisi (varsayilan: %d)\n", BENCH_DEFAULT_MAX_TASKS);
+    printf("  --output <dosya>   JSON sonucunu dosyaya yaz (varsayilan: standart cikti)\n");
+}
+
+int main(int argc, char* argv[]) {
+    int reps = BENCH_DEFAULT_REPS;
+    int warmup = BENCH_DEFAULT_WARMUP;
+    int max_tasks = BENCH_DEFAULT_MAX_TASKS;
+    const char* output_file = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--reps") == 0 && i + 1 < argc) {
+            reps = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--warmup") == 0 && i + 1 < argc) {
+            warmup = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--max-tasks") == 0 && i + 1 < argc) {
+            max_tasks = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--output") == 0 && i + 1 < argc) {
+            output_file = argv[++i];
+        } else {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+    if (reps < 1 || reps > BENCH_MAX_REPS || warmup < 0 || max_tasks < 100) {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    // Zaman asimi satirlari standart ciktiya basilir; JSON'u ayri tut
+    FILE* out = NULL;
+    if (output_file != NULL) {
+        out = fopen(output_file, "w");
+    } else {
+        int fd = dup(STDOUT_FILENO);
+        if (fd >= 0) out = fdopen(fd, "w");
+    }
+    if (out == NULL || freopen("/dev/null", "w", stdout) == NULL) {
+        fprintf(stderr, "[HATA] Cikti acilamadi\n");
+        return 1;
+    }
+
+    if (tasks_reserve(max_tasks + BENCH_QUEUE_OPS) != 0) {
+        fprintf(stderr, "[HATA] Gorevler icin bellek ayrilamadi (%d gorev)\n", max_tasks);
+        return 1;
+    }
+
+    fprintf(out, "{\n  \"benchmark\": \"scheduler_primitives\",\n");
+    fprintf(out, "  \"reps\": %d,\n  \"warmup\": %d,\n  \"results\": [", reps, warmup);
+
+    int first = 1;
+    for (int c = 0; c < BENCH_CASE_COUNT; c++) {
+        for (int tasks = 100; tasks <= max_tasks; tasks *= 10) {
+            long long ops = 0;
+            for (int w = 0; w < warmup; w++) {
+                bench_sample(&BENCH_CASES[c], tasks, &ops);
+            }
+
+            double samples[BENCH_MAX_REPS];
+            for (int r = 0; r < reps; r++) {
+                samples[r] = bench_sample(&BENCH_CASES[c], tasks, &ops);
+            }
+            qsort(samples, (size_t)reps, sizeof(double), compare_double);
+            double median = samples[reps / 2];
+
+            fprintf(out, "%s\n    {\"name\": \"%s\", \"tasks\": %d, \"ops\": %lld, "
+                         "\"ns_per_op\": %.2f, \"ns_per_op_min\": %.2f, \"ops_per_sec\": %.0f",
+                    first ? "" : ",", BENCH_CASES[c].name, tasks, ops,
+                    median, samples[0], median > 0.0 ? 1e9 / median : 0.0);
+            if (BENCH_CASES[c].note != NULL) {
+                fprintf(out, ", \"note\": \"%s\"", BENCH_CASES[c].note);
+            }
+            fprintf(out, "}");
+            first = 0;
+            fflush(out);
+        }
+    }
+    fprintf(out, "\n  ]\n}\n");
+    fclose(out);
+
+    free(g_tasks);
+    return 0;
+}
@@ -0,0 +1,427 @@
+// Simulasyon durum kaydi (checkpoint) ve kaldigi yerden devam (resume)
+//
+// Kayit, scheduler dongusunun basinda alinir: bu noktada calisan gorev yoktur
+// ve tum durum global degiskenlerdedir. Durum once bellekteki tampona varint
+// olarak serilestirilir (hizli), dosyaya yazma arka plan is parcaciginda yapilir.
+// Boylece scheduler dongusu disk gecikmesini beklemez.
+//
+// Varint ve gorev/kuyruk/metrik serilestirme yardimcilari whatif.c'deki hafif
+// kayit gunlugu tarafindan da kullanilir.
+
+#include <errno.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <signal.h>
+#include <stdatomic.h>
+
+#include "scheduler.h"
+
+#define CHECKPOINT_MAGIC        0x4E535246u     // "FRSN"
+#define CHECKPOINT_VERSION      1
+
+// Extern degiskenler (main.c ve metrics.c'de tanimlandi)
+extern TaskInfo* g_tasks;
+extern int g_task_count;
+extern int g_completed_tasks;
+extern int g_current_time;
+extern int g_context_switches;
+extern DynamicQueue g_priority_queues[MAX_PRIORITY_LEVEL];
+extern LevelMetrics g_level_metrics[MAX_PRIORITY_LEVEL];
+extern const char* COLOR_PALETTE[];
+
+// Kayit ayarlari
+static const char* s_checkpoint_path = NULL;
+static int s_checkpoint_interval = CHECKPOINT_DEFAULT_INTERVAL;
+static int s_next_checkpoint_time = 0;
+
+// Arka plan yazici durumu
+static SnapshotBuffer s_write_buffer;
+static pthread_t s_writer_thread;
+static sem_t s_writer_sem;
+static atomic_int s_writer_busy;
+static atomic_int s_writer_stop;
+static int s_writer_started = 0;
+
+// Varint yazma/okuma (isaretli degerler zigzag ile kodlanir)
+int snapshot_reserve(SnapshotBuffer* buf, size_t extra) {
+    if (buf->len + extra <= buf->cap) return 0;
+    size_t cap = buf->cap ? buf->cap : 4096;
+    while (cap < buf->len + extra) cap *= 2;
+    unsigned char* data = realloc(buf->data, cap);
+    if (data == NULL) {
+        buf->error = 1;
+        return -1;
+    }
+    buf->data = data;
+    buf->cap = cap;
+    return 0;
+}
+
+void snapshot_put_uvarint(SnapshotBuffer* buf, uint64_t value) {
+    if (snapshot_reserve(buf, 10) != 0) return;
+    while (value >= 0x80) {
+        buf->data[buf->len++] = (unsigned char)(value | 0x80);
+        value >>= 7;
+    }
+    buf->data[buf->len++] = (unsigned char)value;
+}
+
+void snapshot_put_varint(SnapshotBuffer* buf, int64_t value) {
+    snapshot_put_uvarint(buf, ((uint64_t)value << 1) ^ (uint64_t)(value >> 63));
+}
+
+void snapshot_put_string(SnapshotBuffer* buf, const char* text) {
+    size_t len = strlen(text);
+    snapshot_put_uvarint(buf, len);
+    if (snapshot_reserve(buf, len) != 0) return;
+    memcpy(buf->data + buf->len, text, len);
+    buf->len += len;
+}
+
+uint64_t snapshot_get_uvarint(SnapshotReader* rd) {
+    uint64_t value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        if (rd->pos >= rd->len) break;
+        unsigned char byte = rd->data[rd->pos++];
+        value |= (uint64_t)(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) return value;
+    }
+    rd->error = 1;  // Kesik veya bozuk varint
+    return 0;
+}
+
+int64_t snapshot_get_varint(SnapshotReader* rd) {
+    uint64_t raw = snapshot_get_uvarint(rd);
+    return (int64_t)(raw >> 1) ^ -(int64_t)(raw & 1);
+}
+
+int snapshot_get_int(SnapshotReader* rd, int min_value, int max_value) {
+    int64_t value = snapshot_get_varint(rd);
+    if (value < min_value || value > max_value) {
+        rd->error = 1;
+        return min_value;
+    }
+    return (int)value;
+}
+
+void snapshot_get_string(SnapshotReader* rd, char* out, size_t out_size) {
+    uint64_t len = snapshot_get_uvarint(rd);
+    if (len >= out_size || rd->pos + len > rd->len) {
+        rd->error = 1;
+        out[0] = '\0';
+        return;
+    }
+    memcpy(out, rd->data + rd->pos, (size_t)len);
+    out[len] = '\0';
+    rd->pos += (size_t)len;
+}
+
+// Histogram sadece dolu kovalariyla yazilir (kompakt kayit)
+static void snapshot_put_histogram(SnapshotBuffer* buf, const LatencyHistogram* hist) {
+    int used = 0;
+    for (int i = 0; i < HIST_COUNTS_LEN; i++) {
+        if (hist->counts[i] != 0) used++;
+    }
+    snapshot_put_uvarint(buf, (uint64_t)used);
+    for (int i = 0; i < HIST_COUNTS_LEN; i++) {
+        if (hist->counts[i] == 0) continue;
+        snapshot_put_uvarint(buf, (uint64_t)i);
+        snapshot_put_uvarint(buf, hist->counts[i]);
+    }
+    snapshot_put_varint(buf, hist->total_count);
+    snapshot_put_varint(buf, hist->max_value);
+}
+
+static void snapshot_get_histogram(SnapshotReader* rd, LatencyHistogram* hist) {
+    histogram_reset(hist);
+    uint64_t used = snapshot_get_uvarint(rd);
+    for (uint64_t i = 0; i < used && !rd->error; i++) {
+        uint64_t index = snapshot_get_uvarint(rd);
+        uint64_t count = snapshot_get_uvarint(rd);
+        if (index >= HIST_COUNTS_LEN) {
+            rd->error = 1;
+            return;
+        }
+        hist->counts[index] = (uint32_t)count;
+    }
+    hist->total_count = snapshot_get_varint(rd);
+    hist->max_value = (int)snapshot_get_varint(rd);
+}
+
+// Tum simulasyon durumunu tampona yaz
+static void snapshot_serialize(SnapshotBuffer* buf) {
+    buf->len = 0;
+    buf->error = 0;
+
+    // Baslik ve sabitler (uyumsuz kayitlari reddetmek icin)
+    snapshot_put_uvarint(buf, CHECKPOINT_MAGIC);
+    snapshot_put_uvarint(buf, CHECKPOINT_VERSION);
+    snapshot_put_uvarint(buf, MAX_PRIORITY_LEVEL);
+    snapshot_put_uvarint(buf, HIST_COUNTS_LEN);
+
+    // Sayaclar
+    snapshot_put_varint(buf, g_current_time);
+    snapshot_put_varint(buf, g_task_count);
+    snapshot_put_varint(buf, g_completed_tasks);
+    snapshot_put_varint(buf, g_context_switches);
+
+    // Gorevler
+    for (int i = 0; i < g_task_count; i++) {
+        snapshot_put_task(buf, &g_tasks[i]);
+    }
+
+    snapshot_put_queues(buf);
+    snapshot_put_metrics(buf);
+}
+
+// Tek gorevin tum durumunu yaz (renk kodu gorev id'sinden yeniden hesaplanir)
+void snapshot_put_task(SnapshotBuffer* buf, const TaskInfo* task) {
+    snapshot_put_varint(buf, task->task_id);
+    snapshot_put_string(buf, task->task_name);
+    snapshot_put_varint(buf, task->arrival_time);
+    snapshot_put_varint(buf, task->original_priority);
+    snapshot_put_varint(buf, task->current_priority);
+    snapshot_put_varint(buf, task->burst_time);
+    snapshot_put_varint(buf, task->remaining_time);
+    snapshot_put_varint(buf, task->executed_time);
+    snapshot_put_varint(buf, task->state);
+    snapshot_put_varint(buf, task->type);
+    snapshot_put_varint(buf, task->start_time);
+    snapshot_put_varint(buf, task->completion_time);
+    snapshot_put_varint(buf, task->timeout_printed);
+    snapshot_put_varint(buf, task->last_active_time);
+    snapshot_put_varint(buf, task->waiting_time);
+    snapshot_put_varint(buf, task->response_time);
+    snapshot_put_varint(buf, task->turnaround_time);
+}
+
+// Kuyruklar: gorev pointer'lari indeks olarak saklanir
+void snapshot_put_queues(SnapshotBuffer* buf) {
+    for (int p = 0; p < MAX_PRIORITY_LEVEL; p++) {
+        DynamicQueue* q = &g_priority_queues[p];
+        snapshot_put_varint(buf, q->count);
+        for (int i = 0; i < q->count; i++) {
+            snapshot_put_varint(buf, q->tasks[i] - g_tasks);
+        }
+    }
+}
+
+// Metrik biriktiricileri
+void snapshot_put_metrics(SnapshotBuffer* buf) {
+    for (int p = 0; p < MAX_PRIORITY_LEVEL; p++) {
+        LevelMetrics* m = &g_level_metrics[p];
+        snapshot_put_varint(buf, m->task_count);
+        snapshot_put_varint(buf, m->timeout_count);
+        snapshot_put_varint(buf, m->started_count);
+        snapshot_put_varint(buf, m->total_waiting);
+        snapshot_put_varint(buf, m->total_response);
+        snapshot_put_varint(buf, m->total_turnaround);
+        snapshot_put_histogram(buf, &m->waiting_hist);
+        snapshot_put_histogram(buf, &m->response_hist);
+        snapshot_put_histogram(buf, &m->turnaround_hist);
+    }
+}
+
+// Tampondan durumu geri yukle
+static int snapshot_deserialize(SnapshotReader* rd) {
+    if (snapshot_get_uvarint(rd) != CHECKPOINT_MAGIC ||
+        snapshot_get_uvarint(rd) != CHECKPOINT_VERSION ||
+        snapshot_get_uvarint(rd) != MAX_PRIORITY_LEVEL ||
+        snapshot_get_uvarint(rd) != HIST_COUNTS_LEN) {
+        return -1;
+    }
+
+    g_current_time = snapshot_get_int(rd, 0, INT32_MAX);
+    int task_count = snapshot_get_int(rd, 0, INT32_MAX);
+    g_completed_tasks = snapshot_get_int(rd, 0, task_count);
+    g_context_switches = snapshot_get_int(rd, 0, INT32_MAX);
+    if (rd->error || tasks_reserve(task_count) != 0) return -1;
+    g_task_count = task_count;
+
+    for (int i = 0; i < g_task_count && !rd->error; i++) {
+        snapshot_get_task(rd, &g_tasks[i]);
+    }
+
+    if (snapshot_get_queues(rd) != 0) return -1;
+    snapshot_get_metrics(rd);
+
+    return rd->error ? -1 : 0;
+}
+
+void snapshot_get_task(SnapshotReader* rd, TaskInfo* task) {
+    task->task_id = snapshot_get_int(rd, 0, INT32_MAX);
+    snapshot_get_string(rd, task->task_name, sizeof(task->task_name));
+    task->arrival_time = snapshot_get_int(rd, INT32_MIN, INT32_MAX);
+    task->original_priority = snapshot_get_int(rd, INT32_MIN, INT32_MAX);
+    task->current_priority = snapshot_get_int(rd, INT32_MIN, INT32_MAX);
+    task->burst_time = snapshot_get_int(rd, INT32_MIN, INT32_MAX);
+    task->remaining_time = snapshot_get_int(rd, INT32_MIN, INT32_MAX);
+    task->executed_time = snapshot_get_int(rd, INT32_MIN, INT32_MAX);
+    task->state = (TaskState)snapshot_get_int(rd, TASK_STATE_WAITING, TASK_STATE_TERMINATED);
+    task->type = (TaskType)snapshot_get_int(rd, TASK_TYPE_REALTIME, TASK_TYPE_USER);
+    task->start_time = snapshot_get_int(rd, INT32_MIN, INT32_MAX);
+    task->completion_time = snapshot_get_int(rd, INT32_MIN, INT32_MAX);
+    task->timeout_printed = snapshot_get_int(rd, 0, 1);
+    task->last_active_time = snapshot_get_int(rd, INT32_MIN, INT32_MAX);
+    task->waiting_time = snapshot_get_int(rd, INT32_MIN, INT32_MAX);
+    task->response_time = snapshot_get_int(rd, INT32_MIN, INT32_MAX);
+    task->turnaround_time = snapshot_get_int(rd, INT32_MIN, INT32_MAX);
+    task->last_core = -1;       // Sadece cok cekirdekli modda kullanilir, kaydedilmez
+    task->partial_work = 0;
+    task->color_code = COLOR_PALETTE[task->task_id % COLOR_PALETTE_SIZE];
+}
+
+// Kuyruklari indekslerden yeniden kur (gorevler once yuklenmis olmali)
+int snapshot_get_queues(SnapshotReader* rd) {
+    init_queues();
+    for (int p = 0; p < MAX_PRIORITY_LEVEL && !rd->error; p++) {
+        int count = snapshot_get_int(rd, 0, g_task_count);
+        for (int i = 0; i < count && !rd->error; i++) {
+            queue_add(p, &g_tasks[snapshot_get_int(rd, 0, g_task_count - 1)]);
+        }
+    }
+    return rd->error ? -1 : 0;
+}
+
+void snapshot_get_metrics(SnapshotReader* rd) {
+    metrics_init();
+    for (int p = 0; p < MAX_PRIORITY_LEVEL && !rd->error; p++) {
+        LevelMetrics* m = &g_level_metrics[p];
+        m->task_count = snapshot_get_int(rd, 0, INT32_MAX);
+        m->timeout_count = snapshot_get_int(rd, 0, INT32_MAX);
+        m->started_count = snapshot_get_int(rd, 0, INT32_MAX);
+        m->total_waiting = snapshot_get_varint(rd);
+        m->total_response = snapshot_get_varint(rd);
+        m->total_turnaround = snapshot_get_varint(rd);
+        snapshot_get_histogram(rd, &m->waiting_hist);
+        snapshot_get_histogram(rd, &m->response_hist);
+        snapshot_get_histogram(rd, &m->turnaround_hist);
+    }
+}
+
+// Tamponu dosyaya atomik olarak yaz (once gecici dosya, sonra rename)
+static int snapshot_write_file(const char* path, const SnapshotBuffer* buf) {
+    char tmp_path[512];
+    snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", path);
+
+    FILE* file = fopen(tmp_path, "wb");
+    if (file == NULL) return -1;
+
+    int ok = fwrite(buf->data, 1, buf->len, file) == buf->len;
+    ok = (fclose(file) == 0) && ok;
+    if (!ok) {
+        remove(tmp_path);
+        return -1;
+    }
+
+#ifdef _WIN32
+    remove(path);  // Windows'ta rename hedef dosyanin uzerine yazmaz
+#endif
+    return rename(tmp_path, path);
+}
+
+static void* checkpoint_writer_main(void* arg) {
+    (void)arg;
+
+#ifndef _WIN32
+    // Tick sinyalleri sadece FreeRTOS is parcaciklarina gitmeli
+    sigset_t all_signals;
+    sigfillset(&all_signals);
+    pthread_sigmask(SIG_BLOCK, &all_signals, NULL);
+#endif
+
+    for (;;) {
+        while (sem_wait(&s_writer_sem) != 0 && errno == EINTR) {
+        }
+
+        if (atomic_load(&s_writer_busy)) {
+            if (snapshot_write_file(s_checkpoint_path, &s_write_buffer) != 0) {
+                fprintf(stderr, "[HATA] Durum kaydi yazilamadi: %s\n", s_checkpoint_path);
+            }
+            atomic_store(&s_writer_busy, 0);
+        }
+
+        if (atomic_load(&s_writer_stop)) break;
+    }
+
+    return NULL;
+}
+
+int checkpoint_init(const char* path, int interval) {
+    if (path == NULL) return 0;
+
+    s_checkpoint_path = path;
+    s_checkpoint_interval = interval > 0 ? interval : CHECKPOINT_DEFAULT_INTERVAL;
+    s_next_checkpoint_time = g_current_time + s_checkpoint_interval;
+
+    atomic_store(&s_writer_busy, 0);
+    atomic_store(&s_writer_stop, 0);
+    if (sem_init(&s_writer_sem, 0, 0) != 0) return -1;
+    if (pthread_create(&s_writer_thread, NULL, checkpoint_writer_main, NULL) != 0) {
+        sem_destroy(&s_writer_sem);
+        return -1;
+    }
+    s_writer_started = 1;
+    return 0;
+}
+
+void checkpoint_maybe_save(void) {
+    if (!s_writer_started || g_current_time < s_next_checkpoint_time) return;
+
+    // Onceki kayit hala yaziliyorsa beklemek yerine bir sonraki tura ertele
+    if (atomic_load(&s_writer_busy)) return;
+
+    snapshot_serialize(&s_write_buffer);
+    if (s_write_buffer.error) {
+        fprintf(stderr, "[HATA] Durum kaydi icin bellek yetersiz\n");
+        return;
+    }
+    atomic_store(&s_writer_busy, 1);
+    sem_post(&s_writer_sem);
+
+    s_next_checkpoint_time = g_current_time + s_checkpoint_interval;
+}
+
+void checkpoint_shutdown(void) {
+    if (!s_writer_started) return;
+
+    // Bekleyen yazma bitene kadar yazici is parcacigini bekle
+    atomic_store(&s_writer_stop, 1);
+    sem_post(&s_writer_sem);
+    pthread_join(s_writer_thread, NULL);
+    sem_destroy(&s_writer_sem);
+    s_writer_started = 0;
+
+    free(s_write_buffer.data);
+    memset(&s_write_buffer, 0, sizeof(s_write_buffer));
+}
+
+int checkpoint_load(const char* path) {
+    FILE* file = fopen(path, "rb");
+    if (file == NULL) {
+        printf("[HATA] Durum kaydi acilamadi: %s\n", path);
+        return -1;
+    }
+
+    SnapshotBuffer buf = { NULL, 0, 0, 0 };
+    unsigned char chunk[65536];
+    size_t n;
+    while ((n = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+        if (snapshot_reserve(&buf, n) != 0) break;
+        memcpy(buf.data + buf.len, chunk, n);
+        buf.len += n;
+    }
+    fclose(file);
+
+    SnapshotReader rd = { buf.data, buf.len, 0, 0 };
+    int result = (buf.data != NULL && !buf.error) ? snapshot_deserialize(&rd) : -1;
+    free(buf.data);
+
+    if (result == 0) {
+        result = scheduler_rebuild_indexes();
+    }
+    if (result != 0) {
+        printf("[HATA] Durum kaydi gecersiz veya bozuk: %s\n", path);
+    }
+    return result;
+}
@@ -0,0 +1,73 @@
+// HDR benzeri gecikme histogrami: sabit bellek, logaritmik kovalar
+//
+// Kova 0, [0, HIST_SUB_BUCKET_COUNT) araligini birebir tutar. Sonraki her
+// kova bir oncekinin iki kati genisliktedir ve HIST_SUB_BUCKET_HALF alt kovaya
+// bolunur; boylece her deger ~1/HIST_SUB_BUCKET_HALF goreli hatayla saklanir.
+
+#include "scheduler.h"
+
+// Degerin sayac dizisindeki indeksi
+static int histogram_counts_index(int value) {
+    unsigned int v = (unsigned int)value | (HIST_SUB_BUCKET_COUNT - 1);
+    int bits = 32 - __builtin_clz(v);                   // Degeri tutmak icin gereken bit sayisi
+    int bucket = bits - HIST_SUB_BUCKET_BITS;           // Kova numarasi
+    int sub_bucket = (int)((unsigned int)value >> bucket);  // Kova icindeki alt kova
+    return (bucket + 1) * HIST_SUB_BUCKET_HALF + (sub_bucket - HIST_SUB_BUCKET_HALF);
+}
+
+// Indeksin temsil ettigi araligin en buyuk degeri
+static long long histogram_highest_value(int index) {
+    int bucket = index / HIST_SUB_BUCKET_HALF - 1;
+    int sub_bucket = index % HIST_SUB_BUCKET_HALF + HIST_SUB_BUCKET_HALF;
+    if (bucket < 0) {
+        sub_bucket -= HIST_SUB_BUCKET_HALF;
+        bucket = 0;
+    }
+    long long lowest = (long long)sub_bucket << bucket;
+    return lowest + (1LL << bucket) - 1;
+}
+
+void histogram_reset(LatencyHistogram* hist) {
+    if (hist == NULL) return;
+    memset(hist, 0, sizeof(*hist));
+}
+
+void histogram_record(LatencyHistogram* hist, int value) {
+    if (hist == NULL) return;
+    if (value < 0) value = 0;  // Negatif sure olamaz
+
+    hist->counts[histogram_counts_index(value)]++;
+    hist->total_count++;
+    if (value > hist->max_value) hist->max_value = value;
+}
+
+void histogram_merge(LatencyHistogram* dst, const LatencyHistogram* src) {
+    if (dst == NULL || src == NULL || src->total_count == 0) return;
+
+    for (int i = 0; i < HIST_COUNTS_LEN; i++) {
+        dst->counts[i] += src->counts[i];
+    }
+    dst->total_count += src->total_count;
+    if (src->max_value > dst->max_value) dst->max_value = src->max_value;
+}
+
+int histogram_percentile(const LatencyHistogram* hist, double percentile) {
+    if (hist == NULL || hist->total_count == 0) return 0;
+    if (percentile > 100.0) percentile = 100.0;
+
+    // Hedef sira: en az bu kadar ornek bu degerin altinda/esit olmali
+    double rank = percentile / 100.0 * (double)hist->total_count;
+    long long target = (long long)rank;
+    if ((double)target < rank) target++;  // Yukari yuvarla
+    if (target < 1) target = 1;
+
+    long long seen = 0;
+    for (int i = 0; i < HIST_COUNTS_LEN; i++) {
+        seen += hist->counts[i];
+        if (seen >= target) {
+            long long value = histogram_highest_value(i);
+            return value < hist->max_value ? (int)value : hist->max_value;
+        }
+    }
+    return hist->max_value;
+}
@@ -0,0 +1,414 @@
+// Gercek FreeRTOS gorevleri: her simule gorev bir FreeRTOS gorevi olarak calisir
+//
+// --kernel-tasks ile gelen her gorev icin xTaskCreate ile gercek bir gorev olusturulur;
+// MLFQ seviyesi FreeRTOS onceligine eslenir (seviye 0 en yuksek). Bir sonraki gorevi
+// FreeRTOS secer: scheduler gorevi bildirim beklerken bloklanir, kernel hazir listelerden
+// en yuksek oncelikli gorevi calistirir, gorev kendini kaydedip scheduler'a bildirim
+// gonderir. Secilen gorev calistigi surece tek basina bir "calisan" onceligine alinir;
+// boylece ayni seviyede bekleyenlerin FIFO sirasi bozulmaz. Kesilen gorev
+// vTaskPrioritySet ile yeni (dusurulmus) seviyesinin sonuna, biten veya zaman asimina
+// ugrayan gorev vTaskDelete ile silinir.
+//
+// Zamanlama dongusu tek cekirdekli modla ortaktir (main.c scheduler_run); bu dosya sadece
+// secim, silme ve varis kancalarini verir, dolayisiyla cikti degismez. Kernel'in her
+// secimi muhasebenin secimiyle karsilastirilir ve farklar raporda sayilir.
+// Rapor gorev olusturma, silme ve oncelik degistirme sureleri ile dagitim turunu
+// (scheduler -> gorev -> scheduler, iki baglam degisimi) olcer. Gercek zamanli modda
+// calisan gorev quantum boyunca mesgul calisir; hizli modda sadece dagitimda calisir.
+//
+// Gorev havuzu: TCB ve yiginlar onceden ayrilmis yuvalardan xTaskCreateStatic ile verilir
+// ve vTaskDelete sonrasi bos yuva yiginina geri konur. Boylece olusturma/silme heap_4'un
+// ilk-uyan taramasina girmez, heap parcalanmaz ve eszamanli gorev sayisi 256 KB heap ile
+// sinirli kalmaz. Havuz dolarsa xTaskCreate ile heap'ten ayrilir; --task-pool 0 sadece
+// heap kullanir (karsilastirma icin).
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <time.h>
+
+#include "scheduler.h"
+
+// Extern degiskenler (main.c'de tanimlandi)
+extern TaskInfo* g_tasks;
+extern int g_task_count;
+extern int g_completed_tasks;
+extern int g_current_time;
+extern int g_context_switches;
+
+// Oncelik yerlesimi: scheduler en ustte, altinda calisan gorev, sonra MLFQ seviyeleri
+#define KERNEL_RUNNING_PRIORITY     (configMAX_PRIORITIES - 2)
+#define KERNEL_LEVEL0_PRIORITY      (configMAX_PRIORITIES - 3)
+#define KERNEL_TASK_STACK_DEPTH     configMINIMAL_STACK_SIZE
+#define KERNEL_DISPATCH_TIMEOUT     pdMS_TO_TICKS(1000)     // Kernel hic gorev secmezse
+
+#if configMAX_PRIORITIES < MAX_PRIORITY_LEVEL + 3
+#error "configMAX_PRIORITIES tum MLFQ seviyelerini, calisan gorevi ve scheduler'i kapsamali"
+#endif
+
+// Havuz yuvasi: handle TCB'nin adresidir, yuva ondan bulunur
+typedef struct {
+    StaticTask_t tcb;
+    StackType_t stack[KERNEL_TASK_STACK_DEPTH];
+} KernelTaskSlot;
+
+// Olculen kernel islemleri
+typedef enum {
+    KERNEL_OP_CREATE,           // xTaskCreateStatic veya xTaskCreate
+    KERNEL_OP_DELETE,           // vTaskDelete (yuvanin geri verilmesi dahil)
+    KERNEL_OP_PRIORITY,         // vTaskPrioritySet
+    KERNEL_OP_DISPATCH,         // Bloklanmadan bildirim donene kadar (iki baglam degisimi)
+    KERNEL_OP_LATENCY,          // Bloklanmadan secilen gorevin calismasina kadar
+    KERNEL_OP_COUNT
+} KernelOp;
+
+typedef struct {
+    long long count;
+    long long total_ns;
+    long long max_ns;
+} KernelOpStat;
+
+static const char* KERNEL_OP_NAMES[KERNEL_OP_COUNT] = {
+    "gorev olusturma", "gorev silme", "vTaskPrioritySet", "dagitim turu", "dagitim gecikmesi"
+};
+
+static int s_enabled = 0;
+static int s_failed = 0;                    // Gorev olusturulamadi, simulasyon durduruldu
+static TaskHandle_t s_driver = NULL;        // Scheduler gorevi
+static TaskHandle_t* s_handles = NULL;      // task_id -> FreeRTOS gorevi (NULL: yok)
+static int s_synced = 0;                    // Gorevi olusturulan varis sayisi (varis sirasinda)
+static int s_live = 0;
+static int s_live_peak = 0;
+static long long s_dispatches = 0;
+static long long s_mismatches = 0;          // Kernel'in secimi muhasebeden farkli
+static KernelOpStat s_stats[KERNEL_OP_COUNT];
+
+#if configGENERATE_RUN_TIME_STATS == 1
+// MLFQ seviyesi basina calisma suresi: sayac her quantum sonunda (seviye dusmeden once) ve
+// silmeden once okunur, son okumadan beri gecen sure o anki seviyeye yazilir. vTaskDelete
+// sayaci da sildiginden silinen gorevlerin suresi sadece burada kalir.
+static configRUN_TIME_COUNTER_TYPE s_level_run_time[MAX_PRIORITY_LEVEL];
+static configRUN_TIME_COUNTER_TYPE* s_run_time_mark = NULL;    // task_id -> son okunan sayac
+#endif
+
+// Statik gorev havuzu
+static int s_pool_size = KERNEL_TASK_POOL_DEFAULT;     // --task-pool
+static KernelTaskSlot* s_pool = NULL;
+static int* s_pool_free = NULL;             // Bos yuva indeksleri (yigin)
+static int s_pool_free_count = 0;
+static int s_pool_peak = 0;                 // Ayni anda kullanilan en fazla yuva
+static long long s_pool_overflows = 0;      // Havuz dolu oldugu icin heap'ten ayrilan gorev
+
+// Gorevlerin yazip scheduler'in okudugu son dagitim
+static volatile TaskInfo* s_dispatched = NULL;
+static volatile long long s_run_ns = 0;
+
+static long long kernel_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+static void kernel_stat_add(KernelOp op, long long ns) {
+    KernelOpStat* stat = &s_stats[op];
+    stat->count++;
+    stat->total_ns += ns;
+    if (ns > stat->max_ns) stat->max_ns = ns;
+}
+
+static UBaseType_t kernel_level_priority(int level) {
+    return (UBaseType_t)(KERNEL_LEVEL0_PRIORITY - level);
+}
+
+void kernel_tasks_enable(void) {
+    s_enabled = 1;
+}
+
+int kernel_tasks_enabled(void) {
+    return s_enabled;
+}
+
+int kernel_tasks_failed(void) {
+    return s_failed;
+}
+
+int kernel_tasks_set_pool(int slots) {
+    if (slots < 0) return -1;
+    s_pool_size = slots;
+    return 0;
+}
+
+static int kernel_pool_init(void) {
+    if (s_pool_size == 0) return 0;
+    s_pool = calloc((size_t)s_pool_size, sizeof(KernelTaskSlot));
+    s_pool_free = malloc((size_t)s_pool_size * sizeof(int));
+    if (s_pool == NULL || s_pool_free == NULL) return -1;
+    // Yigin tepesi 0. yuva: dusuk adresler once kullanilir
+    for (int i = 0; i < s_pool_size; i++) {
+        s_pool_free[i] = s_pool_size - 1 - i;
+    }
+    s_pool_free_count = s_pool_size;
+    return 0;
+}
+
+static KernelTaskSlot* kernel_pool_take(void) {
+    if (s_pool_free_count == 0) return NULL;
+    KernelTaskSlot* slot = &s_pool[s_pool_free[--s_pool_free_count]];
+    int used = s_pool_size - s_pool_free_count;
+    if (used > s_pool_peak) s_pool_peak = used;
+    return slot;
+}
+
+// Silinen gorev havuzdansa yuvasini geri ver (heap'ten ayrilanlari kernel serbest birakti)
+static void kernel_pool_release(TaskHandle_t handle) {
+    KernelTaskSlot* slot = (KernelTaskSlot*)(void*)handle;
+    if (s_pool == NULL || slot < s_pool || slot >= s_pool + s_pool_size) return;
+    s_pool_free[s_pool_free_count++] = (int)(slot - s_pool);
+}
+
+// Simule gorevin govdesi: secildigini bildirir. Scheduler daha yuksek oncelikli oldugundan
+// bildirimle hemen ona gecilir; gorev tekrar secilene kadar burada bekler.
+static void kernel_task_main(void* pvParameters) {
+    TaskInfo* task = pvParameters;
+    for (;;) {
+        s_run_ns = kernel_now_ns();
+        s_dispatched = task;
+        xTaskNotifyGive(s_driver);
+    }
+}
+
+static int kernel_create(TaskInfo* task) {
+    TaskHandle_t handle = NULL;
+    UBaseType_t priority = kernel_level_priority(task->current_priority);
+    long long start = kernel_now_ns();
+    KernelTaskSlot* slot = kernel_pool_take();
+    if (slot != NULL) {
+        handle = xTaskCreateStatic(kernel_task_main, task->task_name, KERNEL_TASK_STACK_DEPTH,
+                                   task, priority, slot->stack, &slot->tcb);
+    } else {
+        if (s_pool_size > 0) s_pool_overflows++;
+        if (xTaskCreate(kernel_task_main, task->task_name, KERNEL_TASK_STACK_DEPTH,
+                        task, priority, &handle) != pdPASS) {
+            handle = NULL;
+        }
+    }
+    long long elapsed = kernel_now_ns() - start;
+    if (handle == NULL) {
+        printf("[HATA] FreeRTOS gorevi olusturulamadi (id:%04d, bos heap: %u bayt, calisan gorev: %d)\n",
+               task->task_id, (unsigned)xPortGetFreeHeapSize(), s_live);
+        s_failed = 1;
+        return -1;
+    }
+    kernel_stat_add(KERNEL_OP_CREATE, elapsed);
+    s_handles[task->task_id] = handle;
+    s_live++;
+    if (s_live > s_live_peak) s_live_peak = s_live;
+    return 0;
+}
+
+// Son okumadan beri gecen calisma suresini gorevin su anki seviyesine yaz (--run-time-stats)
+static void kernel_account_run_time(const TaskInfo* task, TaskHandle_t handle) {
+#if configGENERATE_RUN_TIME_STATS == 1
+    if (s_run_time_mark == NULL) return;
+    int level = task->current_priority;
+    if (level < 0) level = 0;
+    if (level >= MAX_PRIORITY_LEVEL) level = MAX_PRIORITY_LEVEL - 1;
+    configRUN_TIME_COUNTER_TYPE counter = ulTaskGetRunTimeCounter(handle);
+    s_level_run_time[level] += counter - s_run_time_mark[task->task_id];
+    s_run_time_mark[task->task_id] = counter;
+#else
+    (void)task;
+    (void)handle;
+#endif
+}
+
+static void kernel_delete(TaskInfo* task) {
+    TaskHandle_t handle = s_handles[task->task_id];
+    if (handle == NULL) return;
+    s_handles[task->task_id] = NULL;
+    kernel_account_run_time(task, handle);
+    long long start = kernel_now_ns();
+    vTaskDelete(handle);        // Baska gorevi silmek TCB'yi hemen birakir
+    kernel_pool_release(handle);
+    kernel_stat_add(KERNEL_OP_DELETE, kernel_now_ns() - start);
+    s_live--;
+}
+
+// Quantum calistigi seviyede biter; seviye dusurulmeden once sure yazilir
+static void kernel_quantum(TaskInfo* task) {
+    TaskHandle_t handle = s_handles[task->task_id];
+    if (handle != NULL) kernel_account_run_time(task, handle);
+}
+
+static void kernel_set_priority(const TaskInfo* task, UBaseType_t priority) {
+    TaskHandle_t handle = s_handles[task->task_id];
+    if (handle == NULL) return;
+    long long start = kernel_now_ns();
+    vTaskPrioritySet(handle, priority);
+    kernel_stat_add(KERNEL_OP_PRIORITY, kernel_now_ns() - start);
+}
+
+// Yeni varislarin gorevlerini olustur. Kesilen gorev de bu adimda kuyruga dondugunden
+// ayni zaman damgali varislarla task_id sirasina gore hazir listeye girer (kuyruk sirasi).
+static void kernel_sync(const TaskInfo* requeued) {
+    int arrived = scheduler_arrived_count();
+    while (s_synced < arrived && !s_failed) {
+        TaskInfo* task = scheduler_arrival_at(s_synced);
+        if (requeued != NULL && task->task_id > requeued->task_id) {
+            kernel_set_priority(requeued, kernel_level_priority(requeued->current_priority));
+            requeued = NULL;
+        }
+        s_synced++;
+        if (task->state == TASK_STATE_READY && task->current_priority < MAX_PRIORITY_LEVEL) {
+            kernel_create(task);
+        }
+    }
+    if (requeued != NULL) {
+        kernel_set_priority(requeued, kernel_level_priority(requeued->current_priority));
+    }
+}
+
+// Scheduler bloklanir, kernel en yuksek oncelikli hazir gorevi calistirir
+static void kernel_dispatch(TaskInfo* expected) {
+    // Gercek zamanli modda onceki gorevin quantum boyunca biraktigi bildirimler
+    ulTaskNotifyValueClear(NULL, UINT32_MAX);
+    s_dispatched = NULL;
+
+    long long start = kernel_now_ns();
+    uint32_t notified = ulTaskNotifyTake(pdTRUE, KERNEL_DISPATCH_TIMEOUT);
+    long long elapsed = kernel_now_ns() - start;
+    TaskInfo* picked = (TaskInfo*)s_dispatched;
+
+    s_dispatches++;
+    if (notified > 0 && picked != NULL) {
+        kernel_stat_add(KERNEL_OP_DISPATCH, elapsed);
+        kernel_stat_add(KERNEL_OP_LATENCY, s_run_ns - start);
+    }
+    if (picked != expected) {
+        s_mismatches++;
+        // Yanlis secilen gorev seviyesinin sonuna alinir, muhasebenin secimi calisir
+        if (picked != NULL && s_handles[picked->task_id] != NULL) {
+            vTaskSuspend(s_handles[picked->task_id]);
+            vTaskResume(s_handles[picked->task_id]);
+        }
+    }
+    kernel_set_priority(expected, KERNEL_RUNNING_PRIORITY);
+}
+
+static void kernel_sync_arrivals(void) {
+    kernel_sync(NULL);
+}
+
+static void kernel_sync_requeued(TaskInfo* task) {
+    kernel_sync(task);
+}
+
+// Tek cekirdekli donguye verilen kancalar: secim, silme (bitis ve zaman asimi) ve varislar
+static const SchedulerHooks KERNEL_HOOKS = {
+    kernel_dispatch,
+    kernel_quantum,
+    kernel_delete,
+    kernel_sync_requeued,
+    kernel_sync_arrivals,
+    kernel_tasks_failed,
+};
+
+void kernel_tasks_run(int last_arrival) {
+    s_handles = calloc((size_t)(g_task_count > 0 ? g_task_count : 1), sizeof(TaskHandle_t));
+    if (s_handles == NULL) {
+        printf("[HATA] Gorev tutamaklari icin bellek ayrilamadi (%d gorev)\n", g_task_count);
+        return;
+    }
+#if configGENERATE_RUN_TIME_STATS == 1
+    s_run_time_mark = calloc((size_t)(g_task_count > 0 ? g_task_count : 1),
+                             sizeof(configRUN_TIME_COUNTER_TYPE));
+    if (s_run_time_mark == NULL) {
+        printf("[HATA] Calisma suresi sayaclari icin bellek ayrilamadi (%d gorev)\n", g_task_count);
+        free(s_handles);
+        s_handles = NULL;
+        return;
+    }
+#endif
+    if (kernel_pool_init() != 0) {
+        printf("[HATA] Gorev havuzu icin bellek ayrilamadi (%d yuva)\n", s_pool_size);
+        free(s_handles);
+        s_handles = NULL;
+#if configGENERATE_RUN_TIME_STATS == 1
+        free(s_run_time_mark);
+        s_run_time_mark = NULL;
+#endif
+        return;
+    }
+    s_driver = xTaskGetCurrentTaskHandle();
+    kernel_sync(NULL);
+
+    scheduler_run(last_arrival, &KERNEL_HOOKS);
+
+    // Simulasyon yarida kaldiysa kalan gorevleri temizle (olcume katilmaz)
+    for (int i = 0; i < g_task_count; i++) {
+        if (s_handles[i] != NULL) {
+            kernel_account_run_time(&g_tasks[i], s_handles[i]);
+            vTaskDelete(s_handles[i]);
+            kernel_pool_release(s_handles[i]);
+            s_handles[i] = NULL;
+        }
+    }
+    s_live = 0;
+    free(s_handles);
+    s_handles = NULL;
+#if configGENERATE_RUN_TIME_STATS == 1
+    free(s_run_time_mark);
+    s_run_time_mark = NULL;
+#endif
+    free(s_pool_free);
+    s_pool_free = NULL;
+    free(s_pool);
+    s_pool = NULL;
+}
+
+// --run-time-stats tablosuna simule gorevlerin MLFQ seviyesi basina sureleri; toplam dondurulur
+double kernel_tasks_print_run_time(double total_ns) {
+    double deleted_ns = 0.0;
+#if configGENERATE_RUN_TIME_STATS == 1
+    if (!s_enabled) return 0.0;
+    for (int level = 0; level < MAX_PRIORITY_LEVEL; level++) {
+        if (s_level_run_time[level] == 0) continue;
+        char name[32];
+        snprintf(name, sizeof(name), "seviye %d", level);
+        double run_ns = (double)s_level_run_time[level];
+        printf("%-20s %14.3f %8.3f%%\n", name, run_ns / 1e3,
+               total_ns > 0.0 ? 100.0 * run_ns / total_ns : 0.0);
+        deleted_ns += run_ns;
+    }
+    printf("%-20s %14.3f %8.3f%%\n", "silinen gorevler", deleted_ns / 1e3,
+           total_ns > 0.0 ? 100.0 * deleted_ns / total_ns : 0.0);
+#else
+    (void)total_ns;
+#endif
+    return deleted_ns;
+}
+
+void kernel_tasks_print_report(void) {
+    if (!s_enabled) return;
+
+    printf("\n=============== FreeRTOS Gorev Raporu ===============\n");
+    printf("%-18s %10s %10s %10s %12s\n", "islem", "adet", "ort(ns)", "max(ns)", "toplam(ms)");
+    for (int i = 0; i < KERNEL_OP_COUNT; i++) {
+        const KernelOpStat* stat = &s_stats[i];
+        printf("%-18s %10lld %10.0f %10lld %12.3f\n",
+               KERNEL_OP_NAMES[i], stat->count,
+               stat->count > 0 ? (double)stat->total_ns / (double)stat->count : 0.0,
+               stat->max_ns, stat->total_ns / 1e6);
+    }
+    printf("\nEn fazla eszamanli gorev : %d\n", s_live_peak);
+    printf("Secim farki              : %lld / %lld dagitim\n",
+           s_mismatches, s_dispatches);
+    if (s_pool_size > 0) {
+        printf("Gorev havuzu             : %d yuva, en fazla %d kullanildi, %lld heap'e tasti\n",
+               s_pool_size, s_pool_peak, s_pool_overflows);
+    } else {
+        printf("Gorev havuzu             : kapali (TCB ve yiginlar heap'ten)\n");
+    }
+    printf("En dusuk bos heap        : %u / %u bayt\n",
+           (unsigned)xPortGetMinimumEverFreeHeapSize(), (unsigned)configTOTAL_HEAP_SIZE);
+    fflush(stdout);
+}
@@ -30,56 +30,157 @@ const char* COLOR_PALETTE[] = {
 #define COLOR_PALETTE_SIZE 25
 
 // Global degiskenler
-TaskInfo g_tasks[MAX_TASKS];
+TaskInfo* g_tasks = NULL;       // Gorev dizisi (yuklenirken buyur)
+int g_task_capacity = 0;
 int g_task_count = 0;
 int g_completed_tasks = 0;
 int g_current_time = 0;
 int g_context_switches = 0;
+int g_fast_mode = 0;            // 1: quantum'lar gercek zamanda beklenmez
+int g_sim_clock = 0;            // 1: tick'ler sadece tum gorevler bloklaninca ilerler
 static volatile int g_simulation_running = 1;
+static int g_resumed = 0;   // Durum kaydindan devam ediliyor mu
+static int g_tick_stats = 0;    // --tick-stats: tick kaynagi raporu
+static int g_run_time_stats = 0;    // --run-time-stats: gorev basina calisma suresi
 
 // Dinamik kuyruklar: 0=RT, 1-3=Kullanici
 DynamicQueue g_priority_queues[MAX_PRIORITY_LEVEL];
 
-// Ana scheduler gorevi
-void vSchedulerTask(void* pvParameters) {
-    (void)pvParameters;
-    
-    // En son gorev varis zamanini bul (simulasyon ne zaman sonlanacak)
-    int last_arrival = 0;
-    for (int i = 0; i < g_task_count; i++) {
-        if (g_tasks[i].arrival_time > last_arrival) {
-            last_arrival = g_tasks[i].arrival_time;
-        }
+// Bir quantum bekle (hizli modda beklemeden ilerlenir)
+void wait_quantum(void) {
+    if (!g_fast_mode) {
+        PROFILE_BEGIN(PROFILE_WAIT);
+        vTaskDelay(pdMS_TO_TICKS(TIME_QUANTUM_MS));  // 1 saniye bekle
+        PROFILE_END(PROFILE_WAIT);
     }
-    
-    // Baslangicta gelen gorevleri kontrol et
-    check_arriving_tasks();
-    
-    // Ana zamanlama dongusu
-    while (g_simulation_running) {
+}
+
+// Tick kaynaginin hedefe gore ulastigi hiz (POSIX portu)
+static void print_tick_stats(void) {
+#ifdef __linux__
+    if (!g_tick_stats) return;
+    PortTickStats_t stats;
+    vPortGetTickStats(&stats);
+    double seconds = (double)stats.ullElapsedNs / 1e9;
+    unsigned long long kernel_ticks = stats.ullProcessed + stats.ullStepped;
+    if (stats.xSimulated) {
+        printf("\nTick kaynagi (simule saat, %.3f sn duvar saati)\n", seconds);
+    } else {
+        printf("\nTick kaynagi (hedef %u Hz, %.3f sn)\n", (unsigned)configTICK_RATE_HZ, seconds);
+    }
+    printf("Uretilen tick   : %llu (%.1f Hz)\n", (unsigned long long)stats.ullGenerated,
+           seconds > 0.0 ? (double)stats.ullGenerated / seconds : 0.0);
+    printf("Kernel tick'i   : %llu (%.1f Hz)\n", kernel_ticks,
+           seconds > 0.0 ? (double)kernel_ticks / seconds : 0.0);
+    printf("Gecikmis tick   : %llu (gec teslim edildi, kaybolmadi)\n", (unsigned long long)stats.ullMissed);
+    printf("Bosta atlanan   : %llu (vTaskStepTick ile eklendi)\n", (unsigned long long)stats.ullStepped);
+    printf("SIGALRM         : %llu (%llu tanesi kesmeler kapaliyken geldi, ertelendi)\n",
+           (unsigned long long)stats.ullSignals, (unsigned long long)stats.ullDeferred);
+    printf("Guvenli nokta   : %llu (bekleyen tick'ler kesmeler acilirken islendi)\n",
+           (unsigned long long)stats.ullSafePointRuns);
+    if (stats.ullWakeups > 0) {
+        printf("Uyanma gecikmesi: ort %.1f us, en fazla %.1f us (%llu uyanma)\n",
+               (double)stats.ullWakeLatencyNs / (double)stats.ullWakeups / 1e3,
+               (double)stats.ullMaxWakeLatencyNs / 1e3, (unsigned long long)stats.ullWakeups);
+    }
+    fflush(stdout);
+#endif
+}
+
+// Gorev basina calisma suresi ve payi (POSIX portlari: 64 bit CLOCK_MONOTONIC ns sayaci).
+// Silinen gorevlerin suresi kernel'de tutulmaz; --kernel-tasks silmeden once seviyesine
+// yazar ve bu sureler ayri satirlarda gosterilir, paylar toplami %100 eder.
+static void print_run_time_stats(void) {
+#if configGENERATE_RUN_TIME_STATS == 1
+    if (!g_run_time_stats) return;
+    UBaseType_t count = uxTaskGetNumberOfTasks();
+    TaskStatus_t* status = malloc(count * sizeof(TaskStatus_t));
+    if (status == NULL) return;
+
+    configRUN_TIME_COUNTER_TYPE total = 0;
+    count = uxTaskGetSystemState(status, count, &total);
+    printf("\nGorev calisma sureleri (toplam %.3f ms)\n", (double)total / 1e6);
+    printf("%-20s %14s %9s\n", "gorev", "sure(us)", "pay");
+    double listed_ns = 0.0;
+    for (UBaseType_t i = 0; i < count; i++) {
+        double run_ns = (double)status[i].ulRunTimeCounter;
+        listed_ns += run_ns;
+        printf("%-20s %14.3f %8.3f%%\n", status[i].pcTaskName, run_ns / 1e3,
+               total > 0 ? 100.0 * run_ns / (double)total : 0.0);
+    }
+    listed_ns += kernel_tasks_print_run_time((double)total);
+    printf("%-20s %14.3f %8.3f%%\n", "toplam", listed_ns / 1e3,
+           total > 0 ? 100.0 * listed_ns / (double)total : 0.0);
+    free(status);
+    fflush(stdout);
+#endif
+}
+
+// Kanca cagrilari (kanca verilmemisse bos)
+static const SchedulerHooks s_no_hooks = { NULL, NULL, NULL, NULL, NULL, NULL };
+
+static int run_stopped(const SchedulerHooks* hooks) {
+    return !g_simulation_running || (hooks->stopped != NULL && hooks->stopped());
+}
+
+static void run_arrivals(const SchedulerHooks* hooks) {
+    if (hooks->on_arrivals != NULL) hooks->on_arrivals();
+}
+
+static void run_terminate(const SchedulerHooks* hooks, TaskInfo* task) {
+    if (hooks->on_terminate != NULL) hooks->on_terminate(task);
+}
+
+// Zamantasimi kontrolu; sonlanan gorevler kancaya da bildirilir
+static void run_timeouts(const SchedulerHooks* hooks) {
+    check_timeouts();
+    if (hooks->on_terminate == NULL) return;
+    int count = 0;
+    TaskInfo* const* expired = scheduler_last_timeouts(&count);
+    for (int i = 0; i < count; i++) {
+        hooks->on_terminate(expired[i]);
+    }
+}
+
+// Tek cekirdekli zamanlama dongusu: RT (FCFS) + kullanici gorevleri (MLFQ)
+void scheduler_run(int last_arrival, const SchedulerHooks* hooks) {
+    if (hooks == NULL) hooks = &s_no_hooks;
+
+    while (!run_stopped(hooks)) {
         TaskInfo* task_to_run = NULL;
         
+        // Periyodik durum kayitlari: dongu basinda calisan gorev yoktur
+        PROFILE_BEGIN(PROFILE_CHECKPOINT);
+        checkpoint_maybe_save();
+        snapshot_log_maybe_record();
+        PROFILE_END(PROFILE_CHECKPOINT);
+        
         // Zamantasimi kontrolu
-        check_timeouts();
+        run_timeouts(hooks);
         
         // 1. RT gorevleri kontrol et (FCFS)
         if (!queue_is_empty(PRIORITY_REALTIME)) {
+            PROFILE_BEGIN(PROFILE_DISPATCH);
             task_to_run = queue_remove(PRIORITY_REALTIME);
+            PROFILE_END(PROFILE_DISPATCH);
             
             if (task_to_run != NULL && task_to_run->state != TASK_STATE_TERMINATED) {
                 // Gorevi baslat
+                if (hooks->on_dispatch != NULL) hooks->on_dispatch(task_to_run);
                 task_start(task_to_run, g_current_time);
                 print_task_status(task_to_run, "basladi");
                 
                 // RT gorev tamamlanana kadar kesintisiz calistir (FCFS)
-                while (task_to_run->remaining_time > 0) {
-                    vTaskDelay(pdMS_TO_TICKS(TIME_QUANTUM_MS));  // 1 saniye bekle
+                while (task_to_run->remaining_time > 0 && !run_stopped(hooks)) {
+                    wait_quantum();                               // 1 saniye bekle
                     g_current_time++;                             // Zamani ilerlet
                     task_execute(task_to_run);                    // 1 saniye calistir
+                    if (hooks->on_quantum != NULL) hooks->on_quantum(task_to_run);
                     task_to_run->last_active_time = g_current_time;  // Son aktif zamani guncelle
                     
                     // Varis kontrolu
                     check_arriving_tasks();
+                    run_arrivals(hooks);
                     
                     // Gorev devam ediyorsa yurutuluyor mesaji
                     if (task_to_run->remaining_time > 0) {
@@ -87,14 +188,16 @@ void vSchedulerTask(void* pvParameters) {
                     }
                     
                     // Timeout kontrolu
-                    check_timeouts();
+                    run_timeouts(hooks);
                 }
+                if (run_stopped(hooks)) break;
                 
                 // RT gorev tamamlandi
                 task_terminate(task_to_run, g_current_time);
                 g_completed_tasks++;
                 print_task_status(task_to_run, "sonlandi");
-                check_timeouts();
+                run_terminate(hooks, task_to_run);
+                run_timeouts(hooks);
                 
                 g_context_switches++;
                 continue;
@@ -102,6 +205,7 @@ void vSchedulerTask(void* pvParameters) {
         }
         
         // 2. Kullanici gorevlerini kontrol et (MLFQ)
+        PROFILE_BEGIN(PROFILE_DISPATCH);
         int queue_index = find_highest_priority_queue();
         
         // RT kuyruk zaten yukarida islendi, kullanici kuyruguna gec
@@ -116,31 +220,40 @@ void vSchedulerTask(void* pvParameters) {
             }
         }
         
+        TaskInfo* user_task = (queue_index > 0) ? queue_remove(queue_index) : NULL;
+        PROFILE_END(PROFILE_DISPATCH);
+        
         if (queue_index > 0) {
-            task_to_run = queue_remove(queue_index);
+            task_to_run = user_task;
             
             if (task_to_run != NULL && task_to_run->state != TASK_STATE_TERMINATED) {
+                if (hooks->on_dispatch != NULL) hooks->on_dispatch(task_to_run);
                 task_start(task_to_run, g_current_time);
                 print_task_status(task_to_run, "basladi");
 
                 // MLFQ: Her quantum'da preemption kontrolu yap
                 while (task_to_run->remaining_time > 0) {
-                    vTaskDelay(pdMS_TO_TICKS(TIME_QUANTUM_MS));  // 1 saniye bekle
+                    wait_quantum();                               // 1 saniye bekle
                     g_current_time++;                             // Zamani ilerlet
                     task_execute(task_to_run);                    // 1 saniye calistir
+                    if (hooks->on_quantum != NULL) hooks->on_quantum(task_to_run);
                     task_to_run->last_active_time = g_current_time;  // Son aktif zamani guncelle
 
-                    // Yeni gelenleri ekle
+                    // Yeni gelenleri ekle (kancaya gorev sonlandiktan veya kuyruga dondukten
+                    // sonra bildirilir)
                     check_arriving_tasks();
 
                     if (task_to_run->remaining_time == 0) {
                         task_terminate(task_to_run, g_current_time);
                         g_completed_tasks++;
                         print_task_status(task_to_run, "sonlandi");
+                        run_terminate(hooks, task_to_run);
+                        run_arrivals(hooks);
                         break;
                     }
 
                     // Oncelik dusur (her quantum)
+                    PROFILE_BEGIN(PROFILE_DISPATCH);
                     demote_priority(task_to_run);
 
                     // Preemption kontrolu: Daha yuksek oncelikli veya ayni oncelikte bekleyen var mi
@@ -148,16 +261,23 @@ void vSchedulerTask(void* pvParameters) {
                     int preempt = 0;
                     if (hpq != -1 && hpq < task_to_run->current_priority) preempt = 1;  // Daha yuksek oncelik
                     else if (hpq == task_to_run->current_priority && !queue_is_empty(hpq)) preempt = 1;  // Ayni oncelikte bekleyen var
+                    PROFILE_END(PROFILE_DISPATCH);
 
                     if (preempt) {
                         task_suspend(task_to_run);
                         print_task_status(task_to_run, "askida");
                         task_resume(task_to_run);
+                        PROFILE_BEGIN(PROFILE_DISPATCH);
                         queue_add(task_to_run->current_priority, task_to_run);
+                        PROFILE_END(PROFILE_DISPATCH);
+                        if (hooks->on_requeue != NULL) hooks->on_requeue(task_to_run);
+                        else run_arrivals(hooks);
                         break;
                     } else {
                         // Kesinti yoksa calismaya devam ediyor
                         print_task_status(task_to_run, "yurutuluyor");
+                        run_arrivals(hooks);
+                        if (run_stopped(hooks)) break;
                     }
                 }
 
@@ -173,16 +293,69 @@ void vSchedulerTask(void* pvParameters) {
         
         // Bekleme - yeni gorevlerin gelmesini bekle
         if (g_current_time <= last_arrival + MAX_TASK_TIME + 10) {
-            vTaskDelay(pdMS_TO_TICKS(TIME_QUANTUM_MS));
+            wait_quantum();
             g_current_time++;
             check_arriving_tasks();
-            check_timeouts();
+            run_arrivals(hooks);
+            run_timeouts(hooks);
         } else {
             break;
         }
     }
+}
+
+// Ana scheduler gorevi
+void vSchedulerTask(void* pvParameters) {
+    (void)pvParameters;
+    PROFILE_BEGIN(PROFILE_LOOP);
+    perf_counters_begin(PERF_PHASE_SIMULATE);
+    
+    // En son gorev varis zamanini bul (simulasyon ne zaman sonlanacak)
+    int last_arrival = 0;
+    for (int i = 0; i < g_task_count; i++) {
+        if (g_tasks[i].arrival_time > last_arrival) {
+            last_arrival = g_tasks[i].arrival_time;
+        }
+    }
+    
+    // Baslangicta gelen gorevleri kontrol et (kayittan devamda zaten yapilmisti)
+    if (!g_resumed) {
+        check_arriving_tasks();
+    }
+    
+    // Cok cekirdekli mod (multicore.c) kendi dongusunu calistirir; gercek gorev modu
+    // (kernel_tasks.c) ayni donguyu kernel kancalariyla calistirir
+    if (multicore_enabled()) {
+        multicore_run(last_arrival);
+    } else if (kernel_tasks_enabled()) {
+        kernel_tasks_run(last_arrival);
+    } else {
+        scheduler_run(last_arrival, NULL);
+    }
     
     g_simulation_running = 0;
+    perf_counters_end(PERF_PHASE_SIMULATE);
+    PROFILE_END(PROFILE_LOOP);
+    
+    // Bekleyen durum kaydinin yazilmasini bitir
+    PROFILE_BEGIN(PROFILE_CHECKPOINT);
+    checkpoint_shutdown();
+    snapshot_log_close();
+    trace_close();
+    PROFILE_END(PROFILE_CHECKPOINT);
+    
+    // Simulasyon sonu metrik raporu
+    PROFILE_BEGIN(PROFILE_REPORT);
+    perf_counters_begin(PERF_PHASE_REPORT);
+    metrics_print_report();
+    multicore_print_report();
+    kernel_tasks_print_report();
+    perf_counters_end(PERF_PHASE_REPORT);
+    PROFILE_END(PROFILE_REPORT);
+    perf_counters_print();
+    print_tick_stats();
+    print_run_time_stats();
+    PROFILE_PRINT();
     
     // Simulasyonu sonlandir
     vTaskEndScheduler();
@@ -191,6 +364,9 @@ void vSchedulerTask(void* pvParameters) {
 // FreeRTOS hook fonksiyonlari
 
 void vApplicationIdleHook(void) {
+#ifdef __linux__
+    vPortIdleHook();    // Tum gorevler bloklu: simule saati ilerlet (POSIX portlari)
+#endif
 }
 
 void vApplicationTickHook(void) {
@@ -219,21 +395,352 @@ void vApplicationGetTimerTaskMemory(StaticTask_t **ppxTimerTaskTCBBuffer,
     *pulTimerTaskStackSize = configMINIMAL_STACK_SIZE * 2;
 }
 
+static void print_usage(const char* program) {
+    printf("Kullanim: %s <giris_dosyasi> [secenekler]\n", program);
+    printf("         %s --resume <kayit_dosyasi> [secenekler]\n", program);
+    printf("         %s --compare <iz_a> <iz_b>\n", program);
+    printf("         %s --generate <dosya> [uretec secenekleri]\n", program);
+    printf("         %s --bench-scale [uretec secenekleri]\n", program);
+    printf("Secenekler:\n");
+    printf("  --checkpoint <dosya>         Durumu periyodik olarak dosyaya kaydet\n");
+    printf("  --checkpoint-interval <sn>   Kayit araligi (varsayilan: %d sn)\n",
+           CHECKPOINT_DEFAULT_INTERVAL);
+    printf("  --resume <dosya>             Kayittan kaldigi yerden devam et\n");
+    printf("  --fast                       Quantum'lari gercek zamanda bekleme\n");
+    printf("  --sim-clock                  vTaskDelay'i simule saatle calistir: tum gorevler bloklaninca zaman atlar (Linux)\n");
+    printf("  --snapshots <dosya>          Ne-olursa analizi icin hafif kayit gunlugu yaz\n");
+    printf("  --snapshot-interval <sn>     Gunluk kayit araligi (varsayilan: %d sn)\n",
+           CHECKPOINT_DEFAULT_INTERVAL);
+    printf("  --whatif <gunluk>            Duzenlenmis is yukunu gunlukteki son uygun kayittan calistir\n");
+    printf("  --trace <dosya>              Durum olaylarini ikili ize yaz\n");
+    printf("  --compare <iz_a> <iz_b>      Iki calismanin izini (metin/ikili) karsilastir\n");
+    printf("  --perf-counters              Fazlar icin donanim sayaclarini raporla (Linux)\n");
+    printf("  --tick-stats                 Tick kaynaginin ulastigi hizi raporla (Linux)\n");
+    printf("  --run-time-stats             Gorev basina calisma suresi ve payini raporla (Linux)\n");
+    printf("  --tick-delivery signal|poll  poll: tick'ler guvenli noktalarda islenir, sinyal sadece yedek (Linux)\n");
+    printf("  --switch-spin <n>            Gorev degisiminde uyumadan once n kez yokla (Linux, varsayilan: 0)\n");
+    printf("  --pin-cpus <tick>,<gorev>    Tick ve gorev is parcaciklarini bu CPU'lara sabitle (Linux)\n");
+    printf("  --rt-priority <n>            Port is parcaciklarini SCHED_FIFO n onceligiyle calistir, tick n+1 (Linux)\n");
+    printf("  --mlock                      Tum bellegi mlockall ile kilitle (Linux)\n");
+    printf("  --cores <n>                  N cekirdekli makineyi simule et (varsayilan: 1)\n");
+    printf("  --migration-cost <quantum>   Cekirdek degistiren gorevin isinma suresi (varsayilan: 0)\n");
+    printf("  --affinity                   Is calmada cekirdek yakinligini koru\n");
+    printf("  --core-speeds <h0,h1,...>    Cekirdeklerin goreli hizlari (ornek: 1.0,1.0,0.4,0.4)\n");
+    printf("  --placement home|speed       speed: RT gorevleri en hizli cekirdeklere yerlestir\n");
+    printf("  --sim-threads <n>            Cekirdekleri n host is parcacigina bol (cikti ayni kalir)\n");
+    printf("  --kernel-tasks               Her gorevi gercek FreeRTOS gorevi olarak calistir\n");
+    printf("  --task-pool <n>              Statik TCB/yigin havuzu (0: heap, varsayilan: %d)\n",
+           KERNEL_TASK_POOL_DEFAULT);
+    printf("Uretec secenekleri:\n");
+    printf("  --tasks <n>                  Gorev sayisi (varsayilan: 1000)\n");
+    printf("  --seed <n>                   PRNG tohumu (varsayilan: 1)\n");
+    printf("  --arrival poisson|bursty     Varis sureci (varsayilan: poisson)\n");
+    printf("  --rate <gorev/sn>            Ortalama varis hizi (varsayilan: 0.3)\n");
+    printf("  --priority-mix w0,w1,w2,w3   Oncelik agirliklari (varsayilan: 1,1,1,1)\n");
+    printf("  --burst-alpha <a>            Pareto sure dagilimi sekli (varsayilan: 1.5)\n");
+    printf("  --bench-max-tasks <n>        Olceklenebilirlik testinde en buyuk boyut (varsayilan: 10000000)\n");
+    printf("Ornek: %s giris.txt --checkpoint durum.bin\n", program);
+}
+
 // Ana fonksiyon
 int main(int argc, char* argv[]) {
-    if (argc < 2) {
-        printf("Kullanim: %s <giris_dosyasi>\n", argv[0]);
-        printf("Ornek: %s giris.txt\n", argv[0]);
+    const char* input_file = NULL;
+    const char* checkpoint_file = NULL;
+    const char* resume_file = NULL;
+    const char* snapshot_file = NULL;
+    const char* whatif_file = NULL;
+    const char* trace_file = NULL;
+    const char* generate_file = NULL;
+    int bench_scale = 0;
+    int bench_max_tasks = 10000000;
+    WorkloadConfig workload;
+    workload_default_config(&workload);
+    int checkpoint_interval = CHECKPOINT_DEFAULT_INTERVAL;
+    int snapshot_interval = CHECKPOINT_DEFAULT_INTERVAL;
+    int migration_cost = 0;
+    int affinity = 0;
+    const char* core_speeds = NULL;
+    const char* placement = NULL;
+    int sim_threads = 1;
+    int task_pool = KERNEL_TASK_POOL_DEFAULT;
+#ifdef __linux__
+    // Port is parcaciklarinin host zamanlamasi (--pin-cpus, --rt-priority, --mlock)
+    PortHostScheduling_t host_sched = { -1, -1, 0, pdFALSE };
+    int host_sched_set = 0;
+#endif
+    
+    // Komut satiri argumanlarini isle
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--checkpoint") == 0 && i + 1 < argc) {
+            checkpoint_file = argv[++i];
+        } else if (strcmp(argv[i], "--checkpoint-interval") == 0 && i + 1 < argc) {
+            checkpoint_interval = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--resume") == 0 && i + 1 < argc) {
+            resume_file = argv[++i];
+        } else if (strcmp(argv[i], "--fast") == 0) {
+            g_fast_mode = 1;
+        } else if (strcmp(argv[i], "--sim-clock") == 0) {
+#ifdef __linux__
+            g_sim_clock = 1;
+            vPortSetSimulatedClock(pdTRUE);
+#else
+            printf("[HATA] --sim-clock sadece POSIX portunda desteklenir\n");
+            return 1;
+#endif
+        } else if (strcmp(argv[i], "--snapshots") == 0 && i + 1 < argc) {
+            snapshot_file = argv[++i];
+        } else if (strcmp(argv[i], "--snapshot-interval") == 0 && i + 1 < argc) {
+            snapshot_interval = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--whatif") == 0 && i + 1 < argc) {
+            whatif_file = argv[++i];
+        } else if (strcmp(argv[i], "--trace") == 0 && i + 1 < argc) {
+            trace_file = argv[++i];
+        } else if (strcmp(argv[i], "--compare") == 0 && i + 2 < argc) {
+            // Karsilastirma modu simulasyon calistirmaz (diff gibi: 0 ayni, 1 farkli, 2 hata)
+            int result = compare_traces(argv[i + 1], argv[i + 2]);
+            return result < 0 ? 2 : result;
+        } else if (strcmp(argv[i], "--perf-counters") == 0) {
+            if (perf_counters_enable() != 0) return 1;
+        } else if (strcmp(argv[i], "--tick-stats") == 0) {
+#ifdef __linux__
+            g_tick_stats = 1;
+#else
+            printf("[HATA] Tick istatistikleri sadece POSIX portunda desteklenir\n");
+            return 1;
+#endif
+        } else if (strcmp(argv[i], "--run-time-stats") == 0) {
+#if configGENERATE_RUN_TIME_STATS == 1
+            g_run_time_stats = 1;
+#else
+            printf("[HATA] Calisma suresi istatistikleri sadece POSIX portunda desteklenir\n");
+            return 1;
+#endif
+        } else if (strcmp(argv[i], "--tick-delivery") == 0 && i + 1 < argc) {
+#ifdef __linux__
+            const char* mode = argv[++i];
+            if (strcmp(mode, "signal") != 0 && strcmp(mode, "poll") != 0) {
+                print_usage(argv[0]);
+                return 1;
+            }
+            vPortSetTickSafePoints(strcmp(mode, "poll") == 0 ? pdTRUE : pdFALSE);
+#else
+            printf("[HATA] --tick-delivery sadece POSIX portunda desteklenir\n");
+            return 1;
+#endif
+        } else if (strcmp(argv[i], "--switch-spin") == 0 && i + 1 < argc) {
+#ifdef __linux__
+            int spin = atoi(argv[++i]);
+            if (spin < 0) {
+                printf("[HATA] Gecersiz yoklama sayisi: %d\n", spin);
+                return 1;
+            }
+            vPortSetSwitchSpin((uint32_t)spin);
+#else
+            printf("[HATA] --switch-spin sadece POSIX portunda desteklenir\n");
+            return 1;
+#endif
+        } else if (strcmp(argv[i], "--pin-cpus") == 0 && i + 1 < argc) {
+#ifdef __linux__
+            if (sscanf(argv[++i], "%d,%d", &host_sched.iTickCpu, &host_sched.iTaskCpu) != 2 ||
+                host_sched.iTickCpu < 0 || host_sched.iTaskCpu < 0) {
+                print_usage(argv[0]);
+                return 1;
+            }
+            host_sched_set = 1;
+#else
+            printf("[HATA] --pin-cpus sadece POSIX portunda desteklenir\n");
+            return 1;
+#endif
+        } else if (strcmp(argv[i], "--rt-priority") == 0 && i + 1 < argc) {
+#ifdef __linux__
+            host_sched.iFifoPriority = atoi(argv[++i]);
+            if (host_sched.iFifoPriority <= 0) {
+                print_usage(argv[0]);
+                return 1;
+            }
+            host_sched_set = 1;
+#else
+            printf("[HATA] --rt-priority sadece POSIX portunda desteklenir\n");
+            return 1;
+#endif
+        } else if (strcmp(argv[i], "--mlock") == 0) {
+#ifdef __linux__
+            host_sched.xLockMemory = pdTRUE;
+            host_sched_set = 1;
+#else
+            printf("[HATA] --mlock sadece POSIX portunda desteklenir\n");
+            return 1;
+#endif
+        } else if (strcmp(argv[i], "--cores") == 0 && i + 1 < argc) {
+            if (multicore_configure(atoi(argv[++i])) != 0) {
+                print_usage(argv[0]);
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--migration-cost") == 0 && i + 1 < argc) {
+            migration_cost = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--affinity") == 0) {
+            affinity = 1;
+        } else if (strcmp(argv[i], "--core-speeds") == 0 && i + 1 < argc) {
+            core_speeds = argv[++i];
+        } else if (strcmp(argv[i], "--placement") == 0 && i + 1 < argc) {
+            placement = argv[++i];
+        } else if (strcmp(argv[i], "--sim-threads") == 0 && i + 1 < argc) {
+            sim_threads = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--kernel-tasks") == 0) {
+            kernel_tasks_enable();
+        } else if (strcmp(argv[i], "--task-pool") == 0 && i + 1 < argc) {
+            task_pool = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--generate") == 0 && i + 1 < argc) {
+            generate_file = argv[++i];
+        } else if (strcmp(argv[i], "--bench-scale") == 0) {
+            bench_scale = 1;
+        } else if (strcmp(argv[i], "--bench-max-tasks") == 0 && i + 1 < argc) {
+            bench_max_tasks = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--tasks") == 0 && i + 1 < argc) {
+            workload.task_count = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            workload.seed = strtoull(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--arrival") == 0 && i + 1 < argc) {
+            if (workload_parse_arrival(argv[++i], &workload) != 0) {
+                print_usage(argv[0]);
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--rate") == 0 && i + 1 < argc) {
+            workload.rate = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--priority-mix") == 0 && i + 1 < argc) {
+            if (workload_parse_mix(argv[++i], &workload) != 0) {
+                print_usage(argv[0]);
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--burst-alpha") == 0 && i + 1 < argc) {
+            workload.burst_alpha = atof(argv[++i]);
+        } else if (argv[i][0] != '-' && input_file == NULL) {
+            input_file = argv[i];
+        } else {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+    
+    // Uretec ve olceklenebilirlik testi simulasyon calistirmaz
+    if (generate_file != NULL) {
+        return workload_generate_file(&workload, generate_file) == 0 ? 0 : 1;
+    }
+    if (bench_scale) {
+        return workload_scale_benchmark(&workload, bench_max_tasks) == 0 ? 0 : 1;
+    }
+    
+    if (input_file == NULL && resume_file == NULL) {
+        print_usage(argv[0]);
+        return 1;
+    }
+    
+    // Kayit gunlugu sadece bastan baslayan temel calismada yazilabilir
+    if (snapshot_file != NULL && (resume_file != NULL || whatif_file != NULL)) {
+        printf("[HATA] --snapshots, --resume veya --whatif ile birlikte kullanilamaz\n");
+        return 1;
+    }
+    if (whatif_file != NULL && (resume_file != NULL || input_file == NULL)) {
+        printf("[HATA] --whatif duzenlenmis bir giris dosyasi gerektirir\n");
+        return 1;
+    }
+    
+    // Hiz listesi --cores verilmediyse cekirdek sayisini da belirler
+    if (core_speeds != NULL && multicore_set_speeds(core_speeds) != 0) {
+        printf("[HATA] Gecersiz cekirdek hizlari: %s\n", core_speeds);
+        return 1;
+    }
+    if (placement != NULL && multicore_set_placement(placement) != 0) {
+        print_usage(argv[0]);
+        return 1;
+    }
+    if (!multicore_enabled() && (migration_cost != 0 || affinity || placement != NULL || sim_threads != 1)) {
+        printf("[HATA] --migration-cost, --affinity, --placement ve --sim-threads icin --cores gerekir\n");
+        return 1;
+    }
+    if (multicore_set_threads(sim_threads) != 0) {
+        print_usage(argv[0]);
+        return 1;
+    }
+    if (multicore_set_migration(migration_cost, affinity) != 0) {
+        print_usage(argv[0]);
         return 1;
     }
     
-    // Kuyruklari baslat
+    // Durum kayitlari tek cekirdegin global kuyruklarini saklar
+    if (multicore_enabled() &&
+        (checkpoint_file != NULL || resume_file != NULL || snapshot_file != NULL || whatif_file != NULL)) {
+        printf("[HATA] --cores, durum kaydi/devam ve ne-olursa secenekleriyle birlikte kullanilamaz\n");
+        return 1;
+    }
+    
+    // FreeRTOS gorevlerinin durumu kayda girmez; tek cekirdekli dongunun yerine gecer
+    if (kernel_tasks_enabled() &&
+        (multicore_enabled() || checkpoint_file != NULL || resume_file != NULL ||
+         snapshot_file != NULL || whatif_file != NULL)) {
+        printf("[HATA] --kernel-tasks, --cores, durum kaydi/devam ve ne-olursa secenekleriyle birlikte kullanilamaz\n");
+        return 1;
+    }
+    // Simule saat --fast'in yerine gecer; calisan gercek gorev mesgul dongude kaldigindan
+    // --kernel-tasks ile zaman hic ilerlemezdi
+    if (g_sim_clock && (g_fast_mode || kernel_tasks_enabled())) {
+        printf("[HATA] --sim-clock, --fast ve --kernel-tasks ile birlikte kullanilamaz\n");
+        return 1;
+    }
+    if (!kernel_tasks_enabled() && task_pool != KERNEL_TASK_POOL_DEFAULT) {
+        printf("[HATA] --task-pool icin --kernel-tasks gerekir\n");
+        return 1;
+    }
+    if (kernel_tasks_set_pool(task_pool) != 0) {
+        print_usage(argv[0]);
+        return 1;
+    }
+    
+#ifdef __linux__
+    // Is parcaciklari scheduler baslarken olusur; ayarlar simdi dogrulanir
+    if (host_sched_set) {
+        int err = iPortSetHostScheduling(&host_sched);
+        if (err != 0) {
+            printf("[HATA] Host zamanlamasi ayarlanamadi: %s\n", strerror(err));
+            return 1;
+        }
+    }
+#endif
+
+    // Kuyruklari ve metrikleri baslat
     init_queues();
+    metrics_init();
     
-    // Gorevleri dosyadan yukle
-    if (load_tasks_from_file(argv[1]) <= 0) {
+    perf_counters_begin(PERF_PHASE_LOAD);
+    if (resume_file != NULL) {
+        // Kayittan devam: gorevler, kuyruklar ve sayaclar kayittan gelir
+        if (checkpoint_load(resume_file) != 0) {
+            return 1;
+        }
+        g_resumed = 1;
+    } else if (load_tasks_from_file(input_file) <= 0) {
+        // Gorevleri dosyadan yukle
         printf("[HATA] Gorev yuklenemedi!\n");
         return 1;
+    } else if (whatif_file != NULL) {
+        // Ne-olursa: duzenlemenin etkilemedigi en son kayittan devam et
+        if (whatif_prepare(whatif_file, &g_resumed) != 0) {
+            return 1;
+        }
+    }
+    perf_counters_end(PERF_PHASE_LOAD);
+    
+    if (checkpoint_init(checkpoint_file, checkpoint_interval) != 0) {
+        printf("[HATA] Durum kaydi baslatilamadi: %s\n", checkpoint_file);
+        return 1;
+    }
+    if (snapshot_log_open(snapshot_file, snapshot_interval) != 0) {
+        printf("[HATA] Kayit gunlugu olusturulamadi: %s\n", snapshot_file);
+        return 1;
+    }
+    if (trace_open(trace_file) != 0) {
+        printf("[HATA] Olay izi olusturulamadi: %s\n", trace_file);
+        return 1;
     }
     
     // Scheduler gorevini olustur
@@ -248,6 +755,11 @@ int main(int argc, char* argv[]) {
     
     // FreeRTOS scheduler'i baslat
     vTaskStartScheduler();
-    
+
+    // Yarida kalan calisma betiklere basarili gorunmesin
+    if (kernel_tasks_failed()) {
+        return 1;
+    }
+
     return 0;
 }
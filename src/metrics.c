@@ -0,0 +1,156 @@
+// Zamanlama metrikleri: bekleme, yanit ve donus sureleri
+// Ortalamalar ve yuzdelik dagilimlar gorev sayisindan bagimsiz sabit bellekle tutulur
+
+#include "scheduler.h"
+
+// Extern degiskenler (main.c'de tanimlandi)
+extern TaskInfo* g_tasks;
+extern int g_task_count;
+extern int g_context_switches;
+
+// Oncelik seviyesi basina metrikler (orijinal oncelige gore)
+LevelMetrics g_level_metrics[MAX_PRIORITY_LEVEL];
+
+// Seviye indeksini sinirla (kuyruga giremeyen oncelikler son seviyeye yazilir)
+static int metrics_level_index(int priority) {
+    if (priority < 0) return 0;
+    if (priority >= MAX_PRIORITY_LEVEL) return MAX_PRIORITY_LEVEL - 1;
+    return priority;
+}
+
+// Raporda gosterilen yuzdelikler
+static const double REPORT_PERCENTILES[] = { 50.0, 90.0, 99.0, 99.9 };
+#define REPORT_PERCENTILE_COUNT (int)(sizeof(REPORT_PERCENTILES) / sizeof(REPORT_PERCENTILES[0]))
+
+static double metrics_average(long long total, int count) {
+    return count > 0 ? (double)total / count : 0.0;
+}
+
+// Tek satir yuzdelik ozeti: p50 p90 p99 p99.9 max
+static void metrics_print_percentile_row(const char* label, const LatencyHistogram* hist) {
+    printf("%-7s %8lld", label, hist->total_count);
+    for (int i = 0; i < REPORT_PERCENTILE_COUNT; i++) {
+        printf(" %6d", histogram_percentile(hist, REPORT_PERCENTILES[i]));
+    }
+    printf(" %6d\n", hist->max_value);
+}
+
+// Histogram secimi (rapor tablolari icin)
+typedef enum {
+    METRIC_WAITING,
+    METRIC_RESPONSE,
+    METRIC_TURNAROUND
+} MetricKind;
+
+static const LatencyHistogram* metrics_histogram(const LevelMetrics* m, MetricKind kind) {
+    switch (kind) {
+        case METRIC_WAITING:  return &m->waiting_hist;
+        case METRIC_RESPONSE: return &m->response_hist;
+        default:              return &m->turnaround_hist;
+    }
+}
+
+static void metrics_print_percentile_table(const char* title, const LevelMetrics* total,
+                                           MetricKind kind) {
+    printf("\n%s\n", title);
+    printf("%-7s %8s %6s %6s %6s %6s %6s\n",
+           "oncelik", "ornek", "p50", "p90", "p99", "p99.9", "max");
+    for (int i = 0; i < MAX_PRIORITY_LEVEL; i++) {
+        const LevelMetrics* m = &g_level_metrics[i];
+        const LatencyHistogram* hist = metrics_histogram(m, kind);
+        if (hist->total_count == 0) continue;
+        char label[16];
+        snprintf(label, sizeof(label), "%d", i);
+        metrics_print_percentile_row(label, hist);
+    }
+    metrics_print_percentile_row("toplam", metrics_histogram(total, kind));
+}
+
+void metrics_init(void) {
+    memset(g_level_metrics, 0, sizeof(g_level_metrics));
+}
+
+void metrics_record_task(TaskInfo* task) {
+    if (task == NULL) return;
+
+    // Gorev sonlanirken metrikleri hesapla, tekrar tarama gerekmez
+    task->turnaround_time = task->completion_time - task->arrival_time;
+    task->waiting_time = task->turnaround_time - task->executed_time;
+    task->response_time = (task->start_time >= 0) ? task->start_time - task->arrival_time : -1;
+
+    LevelMetrics* m = &g_level_metrics[metrics_level_index(task->original_priority)];
+    m->task_count++;
+    if (task->timeout_printed) m->timeout_count++;
+    m->total_waiting += task->waiting_time;
+    m->total_turnaround += task->turnaround_time;
+    if (task->response_time >= 0) {
+        m->started_count++;
+        m->total_response += task->response_time;
+        histogram_record(&m->response_hist, task->response_time);
+    }
+    histogram_record(&m->waiting_hist, task->waiting_time);
+    histogram_record(&m->turnaround_hist, task->turnaround_time);
+}
+
+void metrics_print_report(void) {
+    printf("\n=============== Simulasyon Raporu ===============\n");
+
+    // Gorev bazli tablo (degerler sonlanma aninda hesaplandi)
+    printf("%-8s %5s %7s %4s %7s %5s %7s %5s %5s %s\n",
+           "gorev", "varis", "oncelik", "sure", "baslama", "bitis",
+           "bekleme", "yanit", "donus", "durum");
+    for (int i = 0; i < g_task_count; i++) {
+        TaskInfo* task = &g_tasks[i];
+        if (task->state != TASK_STATE_TERMINATED) {
+            printf("%-8s %5d %7d %4d %7s %5s %7s %5s %5s %s\n",
+                   task->task_name, task->arrival_time, task->original_priority,
+                   task->burst_time, "-", "-", "-", "-", "-", "bitmedi");
+            continue;
+        }
+        printf("%-8s %5d %7d %4d %7d %5d %7d %5d %5d %s\n",
+               task->task_name, task->arrival_time, task->original_priority,
+               task->burst_time, task->start_time, task->completion_time,
+               task->waiting_time, task->response_time, task->turnaround_time,
+               task->timeout_printed ? "zamanasimi" : "tamamlandi");
+    }
+
+    // Oncelik seviyesi bazli ortalamalar
+    // Histogramlar buyuk oldugu icin toplam yigin yerine statik alanda tutulur
+    static LevelMetrics total;
+    memset(&total, 0, sizeof(total));
+
+    printf("\n%-7s %5s %10s %11s %9s %9s\n",
+           "oncelik", "gorev", "zamanasimi", "ort.bekleme", "ort.yanit", "ort.donus");
+    for (int i = 0; i < MAX_PRIORITY_LEVEL; i++) {
+        LevelMetrics* m = &g_level_metrics[i];
+        if (m->task_count == 0) continue;
+        printf("%-7d %5d %10d %11.2f %9.2f %9.2f\n",
+               i, m->task_count, m->timeout_count,
+               metrics_average(m->total_waiting, m->task_count),
+               metrics_average(m->total_response, m->started_count),
+               metrics_average(m->total_turnaround, m->task_count));
+
+        total.task_count += m->task_count;
+        total.timeout_count += m->timeout_count;
+        total.started_count += m->started_count;
+        total.total_waiting += m->total_waiting;
+        total.total_response += m->total_response;
+        total.total_turnaround += m->total_turnaround;
+        histogram_merge(&total.waiting_hist, &m->waiting_hist);
+        histogram_merge(&total.response_hist, &m->response_hist);
+        histogram_merge(&total.turnaround_hist, &m->turnaround_hist);
+    }
+    printf("%-7s %5d %10d %11.2f %9.2f %9.2f\n",
+           "toplam", total.task_count, total.timeout_count,
+           metrics_average(total.total_waiting, total.task_count),
+           metrics_average(total.total_response, total.started_count),
+           metrics_average(total.total_turnaround, total.task_count));
+
+    metrics_print_percentile_table("Bekleme suresi dagilimi (sn)", &total, METRIC_WAITING);
+    metrics_print_percentile_table("Yanit suresi dagilimi (sn)", &total, METRIC_RESPONSE);
+    metrics_print_percentile_table("Donus suresi dagilimi (sn)", &total, METRIC_TURNAROUND);
+
+    printf("\nToplam baglam degisimi : %d\n", g_context_switches);
+    printf("Toplam zaman asimi     : %d\n", total.timeout_count);
+    fflush(stdout);
+}
@@ -0,0 +1,603 @@
+// Cok cekirdekli simulasyon: cekirdek basina MLFQ kuyruklari ve is calma
+//
+// --cores N (N > 1) ile her simule cekirdegin kendi oncelik kuyruk seti vardir.
+// Gelen gorevler ev cekirdegine (task_id % N) yerlestirilir; kendi kuyruklari bos
+// kalan bosta cekirdek en yogun komsusunun en yuksek oncelikli kuyrugunun basindan
+// gorev calar (goc). Zaman her adimda bir quantum ilerler ve tum cekirdekler ayni
+// adimda calisir. Kurallar tek cekirdekle aynidir: RT gorevler kendi cekirdeginde
+// kesintisiz, kullanici gorevleri her quantum onceligi dusurulerek calisir.
+//
+// Goc bedeli: gorev en son calistigi cekirdekten baska bir cekirdekte baslarsa
+// onbellek isinmasi icin --migration-cost kadar quantum is yapmadan calisir.
+// --affinity ile calma yakinlik duyarli olur: once hic calismamis (soguk) veya zaten
+// bu cekirdekte isinmis gorevler alinir; sicak gorev ancak kurbanin kuyrugundaki
+// bekleme goc bedelinden uzunsa tasinir.
+//
+// Heterojen cekirdekler: --core-speeds ile her cekirdegin goreli hizi verilir (ornegin
+// 1.0 ve 0.4). Yavas cekirdekte bir quantum, gorevin kalan suresinden hiziyla orantili
+// is dusurur; kesirli ilerleme gorevle birlikte tasinir. --placement speed ile RT
+// gorevler en hizli cekirdeklerin en bos olanina yerlestirilir ve daha yavas cekirdekler
+// RT gorev calamaz. Enerji, mesgul quantum basina hiz^3 (DVFS yaklasimi) olarak tahmin edilir.
+//
+// Paralel simulasyon: --sim-threads T ile cekirdekler T host is parcacigina bolunur.
+// Bir adimda cekirdekler arasi etkilesim (zaman asimi, varis dagitimi, is calma) seri,
+// cekirdege yerel isler (kendi kuyrugundan gorev alma, quantum'u calistirma ve MLFQ
+// karari) paralel yapilir; is parcaciklari quantum sinirlarinda bariyerle bulusur.
+// Paralel fazda her cekirdek en fazla bir olay (basladi/yurutuluyor/askida/sonlandi)
+// biriktirir; olaylar seri olarak cekirdek sirasiyla islenir. Boylece cikti, metrikler
+// ve iz is parcacigi sayisindan bagimsiz olarak tek is parcacikli motorla aynidir.
+
+#define _POSIX_C_SOURCE 200809L     // pthread_barrier_t, pthread_sigmask
+
+#include <pthread.h>
+#include <signal.h>
+#include <stdint.h>
+
+#include "scheduler.h"
+
+// Extern degiskenler (main.c'de tanimlandi)
+extern TaskInfo* g_tasks;
+extern int g_task_count;
+extern int g_completed_tasks;
+extern int g_current_time;
+extern int g_context_switches;
+
+#define MULTICORE_MAX_CORES     1024
+#define AFFINITY_SCAN_DEPTH     32      // Yakinlik aramasinda kuyrukta bakilan en fazla gorev
+#define SPEED_MAX               8.0     // Izin verilen en yuksek goreli hiz
+#define MULTICORE_MAX_THREADS   256
+
+// Paralel fazda biriktirilen, seri islenen cekirdek olayi
+typedef enum {
+    CORE_EVENT_NONE,
+    CORE_EVENT_START,           // basladi
+    CORE_EVENT_RUNNING,         // yurutuluyor
+    CORE_EVENT_SUSPEND,         // askida (gorev kuyruga geri kondu)
+    CORE_EVENT_FINISH           // sonlandi
+} CoreEvent;
+
+// Is parcaciklarinin calistirdigi cekirdege yerel fazlar
+typedef enum {
+    CORE_PHASE_DISPATCH,        // Kendi kuyrugundan gorev al
+    CORE_PHASE_EXECUTE,         // Quantum'u calistir ve MLFQ kararini ver
+    CORE_PHASE_EXIT
+} CorePhase;
+
+// Simule cekirdek
+typedef struct {
+    DynamicQueue* queues;       // Bu cekirdegin oncelik kuyruklari (MAX_PRIORITY_LEVEL adet)
+    TaskInfo* current;          // Calisan gorev (NULL: bosta)
+    int speed;                  // Goreli hiz (SPEED_SCALE = 1.0)
+    long long busy_quanta;      // Gorev calistirilan quantum sayisi
+    int dispatches;             // Baslatilan gorev sayisi
+    int steals;                 // Komsudan calinan gorev sayisi
+    int stolen;                 // Komsulara kaptirilan gorev sayisi
+    int warmup_left;            // Calisan gorevin kalan isinma quantum'u
+    long long warmup_quanta;    // Goc bedeli olarak harcanan quantum sayisi
+    int migrations;             // Bu cekirdekte baslayan sicak gorev sayisi
+    CoreEvent event;            // Islenmeyi bekleyen olay
+    TaskInfo* event_task;
+} SimCore;
+
+static int s_core_count = 1;
+static SimCore* s_cores = NULL;
+static DynamicQueue* s_core_queues = NULL;
+static long long s_total_steps = 0;         // Simule edilen quantum sayisi
+static int s_migration_cost = 0;            // Goc sonrasi isinma suresi (quantum)
+static int s_affinity = 0;                  // Yakinlik duyarli calma
+static int* s_core_speeds = NULL;           // --core-speeds (NULL: hepsi 1.0)
+static int s_max_speed = SPEED_SCALE;
+static PlacementPolicy s_placement = PLACEMENT_HOME;
+static long long s_steals = 0;
+static long long s_spread_sum = 0;          // Adim basina (en yogun - en bos) yuk toplami
+
+// Paralel motor
+static int s_sim_threads = 1;               // --sim-threads
+static int s_thread_count = 1;              // Calisan is parcacigi sayisi (cekirdek sayisiyla sinirli)
+static pthread_t* s_workers = NULL;
+static pthread_barrier_t s_phase_barrier;
+static pthread_mutex_t s_start_lock = PTHREAD_MUTEX_INITIALIZER;   // Bariyer hazir olana kadar tutulur
+static int s_start_failed = 0;
+static CorePhase s_phase;
+
+int multicore_configure(int cores) {
+    if (cores < 1 || cores > MULTICORE_MAX_CORES) return -1;
+    s_core_count = cores;
+    return 0;
+}
+
+int multicore_set_migration(int cost, int affinity) {
+    if (cost < 0) return -1;
+    s_migration_cost = cost;
+    s_affinity = affinity;
+    return 0;
+}
+
+// "1.0,0.4,..." bicimindeki hiz listesi; --cores verilmediyse cekirdek sayisini belirler
+int multicore_set_speeds(const char* text) {
+    int speeds[MULTICORE_MAX_CORES];
+    int count = 0;
+    const char* p = text;
+    for (;;) {
+        char* end;
+        double value = strtod(p, &end);
+        if (end == p || value <= 0.0 || value > SPEED_MAX || count >= MULTICORE_MAX_CORES) return -1;
+        speeds[count++] = (int)(value * SPEED_SCALE + 0.5);
+        p = end;
+        if (*p == '\0') break;
+        if (*p != ',') return -1;
+        p++;
+    }
+    if (s_core_count > 1 && count != s_core_count) return -1;
+    if (count < 2) return -1;
+
+    int* copy = malloc((size_t)count * sizeof(int));
+    if (copy == NULL) return -1;
+    memcpy(copy, speeds, (size_t)count * sizeof(int));
+    free(s_core_speeds);
+    s_core_speeds = copy;
+    s_core_count = count;
+    s_max_speed = 0;
+    for (int c = 0; c < count; c++) {
+        if (speeds[c] > s_max_speed) s_max_speed = speeds[c];
+    }
+    return 0;
+}
+
+int multicore_set_placement(const char* text) {
+    if (strcmp(text, "home") == 0) {
+        s_placement = PLACEMENT_HOME;
+    } else if (strcmp(text, "speed") == 0) {
+        s_placement = PLACEMENT_SPEED;
+    } else {
+        return -1;
+    }
+    return 0;
+}
+
+int multicore_set_threads(int threads) {
+    if (threads < 1 || threads > MULTICORE_MAX_THREADS) return -1;
+    s_sim_threads = threads;
+    return 0;
+}
+
+int multicore_enabled(void) {
+    return s_core_count > 1;
+}
+
+// Cekirdekteki first_level ve alti seviyelerde hazir gorev sayisi (bastaki sonlanmislar haric)
+static int core_ready_count(const SimCore* core, int first_level) {
+    int count = 0;
+    for (int p = first_level; p < MAX_PRIORITY_LEVEL; p++) {
+        count += core->queues[p].count - core->queues[p].expired_count;
+    }
+    return count;
+}
+
+static int core_load(const SimCore* core) {
+    return core_ready_count(core, PRIORITY_REALTIME) + (core->current != NULL ? 1 : 0);
+}
+
+// Cekirdegin en yuksek oncelikli dolu kuyrugu (tek cekirdekteki queue_is_empty ile ayni anlam)
+static int core_highest_queue(const SimCore* core) {
+    for (int p = 0; p < MAX_PRIORITY_LEVEL; p++) {
+        if (core->queues[p].count > 0) return p;
+    }
+    return -1;
+}
+
+// first_level ve alti kuyruklarin basindan calisabilir ilk gorevi al
+static TaskInfo* core_take(SimCore* core, int first_level) {
+    for (int p = first_level; p < MAX_PRIORITY_LEVEL; p++) {
+        if (core->queues[p].count == 0) continue;
+        TaskInfo* task = queue_pop_head(&core->queues[p]);
+        if (task != NULL) return task;
+    }
+    return NULL;
+}
+
+// Cekirdegin calabilecegi en yuksek seviye: hiz yerlesiminde RT gorevler yavas cekirdege gecmez
+static int core_first_steal_level(const SimCore* core) {
+    if (s_placement == PLACEMENT_SPEED && core->speed < s_max_speed) return PRIORITY_HIGH;
+    return PRIORITY_REALTIME;
+}
+
+// Yeni gelen gorevin cekirdegi
+static int multicore_place(const TaskInfo* task) {
+    if (s_placement == PLACEMENT_SPEED && task->type == TASK_TYPE_REALTIME) {
+        // En hizli cekirdeklerden en az yuklu olani (esitlikte kucuk numara)
+        int best = -1;
+        int best_load = 0;
+        for (int c = 0; c < s_core_count; c++) {
+            if (s_cores[c].speed != s_max_speed) continue;
+            int load = core_load(&s_cores[c]);
+            if (best < 0 || load < best_load) {
+                best = c;
+                best_load = load;
+            }
+        }
+        return best;
+    }
+    return task->task_id % s_core_count;
+}
+
+// check_arriving_tasks global kuyruklara ekler; oradan cekirdeklere dagit
+static void multicore_distribute_arrivals(void) {
+    check_arriving_tasks();
+    for (int p = 0; p < MAX_PRIORITY_LEVEL; p++) {
+        TaskInfo* task;
+        while ((task = queue_remove(p)) != NULL) {
+            queue_insert_sorted(&s_cores[multicore_place(task)].queues[p], task);
+        }
+    }
+}
+
+// Yakinlik duyarli calma: kurbanin en yuksek oncelikli dolu seviyesinde bedelsiz
+// tasinabilen (soguk ya da bu cekirdekte isinmis) gorevi ara
+static TaskInfo* core_steal(int thief, SimCore* victim, int victim_ready) {
+    int first_level = core_first_steal_level(&s_cores[thief]);
+    if (!s_affinity) return core_take(victim, first_level);
+
+    for (int p = first_level; p < MAX_PRIORITY_LEVEL; p++) {
+        DynamicQueue* q = &victim->queues[p];
+        if (q->count - q->expired_count == 0) continue;
+
+        int end = q->count < q->expired_count + AFFINITY_SCAN_DEPTH ? q->count : q->expired_count + AFFINITY_SCAN_DEPTH;
+        for (int k = q->expired_count; k < end; k++) {
+            TaskInfo* task = q->tasks[k];
+            if (task->state == TASK_STATE_TERMINATED) continue;
+            if (task->last_core < 0 || task->last_core == thief) return queue_remove_at(q, k);
+        }
+        break;  // Daha dusuk seviyeden calmak oncelik sirasini bozar
+    }
+
+    // Sicak gorev: kurbanda bekleyecegi sure goc bedelinden uzunsa tasimaya deger
+    if (victim_ready > s_migration_cost) return core_take(victim, first_level);
+    return NULL;
+}
+
+static void core_post(SimCore* core, CoreEvent event, TaskInfo* task) {
+    core->event = event;
+    core->event_task = task;
+}
+
+// Sadece cekirdegin ve gorevin kendi durumuna dokunur (paralel fazda guvenli)
+static void core_start(SimCore* core, TaskInfo* task) {
+    int core_index = (int)(core - s_cores);
+    if (task->last_core >= 0 && task->last_core != core_index) {
+        core->warmup_left = s_migration_cost;
+        core->migrations++;
+    } else {
+        core->warmup_left = 0;
+    }
+    task->last_core = core_index;
+    core->current = task;
+    core->dispatches++;
+    task_start(task, g_current_time);
+    core_post(core, CORE_EVENT_START, task);
+}
+
+// Bekleyen olayi isle: cikti ve global sayaclar sadece burada degisir
+static void core_commit_event(SimCore* core) {
+    TaskInfo* task = core->event_task;
+    switch (core->event) {
+        case CORE_EVENT_NONE:
+            return;
+        case CORE_EVENT_START:
+            print_task_status(task, "basladi");
+            break;
+        case CORE_EVENT_RUNNING:
+            print_task_status(task, "yurutuluyor");
+            break;
+        case CORE_EVENT_SUSPEND:
+            task_suspend(task);
+            print_task_status(task, "askida");
+            task_resume(task);
+            g_context_switches++;
+            break;
+        case CORE_EVENT_FINISH:
+            task_terminate(task, g_current_time);
+            g_completed_tasks++;
+            print_task_status(task, "sonlandi");
+            g_context_switches++;
+            break;
+    }
+    core->event = CORE_EVENT_NONE;
+}
+
+// Paralel fazin olaylarini cekirdek sirasiyla isle (seri motorla ayni sira)
+static void multicore_commit_events(void) {
+    for (int c = 0; c < s_core_count; c++) {
+        core_commit_event(&s_cores[c]);
+    }
+}
+
+static void core_dispatch_own(SimCore* core) {
+    if (core->current != NULL) return;
+    TaskInfo* task = core_take(core, PRIORITY_REALTIME);
+    if (task != NULL) core_start(core, task);
+}
+
+// Kendi kuyrugundan alamayan bosta cekirdekler en yogun komsudan calar (seri)
+static void multicore_steal(void) {
+    for (int c = 0; c < s_core_count; c++) {
+        SimCore* core = &s_cores[c];
+        if (core->current != NULL) continue;
+
+        int victim = -1;
+        int victim_load = 0;
+        for (int v = 0; v < s_core_count; v++) {
+            int ready = core_ready_count(&s_cores[v], core_first_steal_level(core));
+            if (v != c && ready > victim_load) {
+                victim = v;
+                victim_load = ready;
+            }
+        }
+        if (victim < 0) continue;
+
+        TaskInfo* task = core_steal(c, &s_cores[victim], victim_load);
+        if (task == NULL) continue;
+        core->steals++;
+        s_cores[victim].stolen++;
+        s_steals++;
+        core_start(core, task);
+        core_commit_event(core);
+    }
+}
+
+// Quantum'u calistir, ardindan sonlanma, RT devam veya MLFQ dusurme/kesme karari
+static void core_execute(SimCore* core) {
+    TaskInfo* task = core->current;
+    if (task == NULL) return;
+
+    if (core->warmup_left > 0) {
+        // Goc sonrasi isinma: cekirdek mesgul ama gorev ilerlemez
+        core->warmup_left--;
+        core->warmup_quanta++;
+    } else {
+        // Hiz orantili ilerleme: her tam birim kalan sureden bir saniye duser
+        task->partial_work += core->speed;
+        while (task->partial_work >= SPEED_SCALE && task->remaining_time > 0) {
+            task_execute(task);
+            task->partial_work -= SPEED_SCALE;
+        }
+        if (task->remaining_time == 0) task->partial_work = 0;
+    }
+    task->last_active_time = g_current_time;
+    core->busy_quanta++;
+
+    if (task->remaining_time == 0) {
+        core->current = NULL;
+        core_post(core, CORE_EVENT_FINISH, task);
+        return;
+    }
+
+    // RT gorev tamamlanana kadar kesintisiz calisir (FCFS)
+    if (task->type == TASK_TYPE_REALTIME) {
+        core_post(core, CORE_EVENT_RUNNING, task);
+        return;
+    }
+
+    demote_priority(task);
+    int hpq = core_highest_queue(core);
+    if (hpq != -1 && hpq <= task->current_priority) {
+        queue_insert_sorted(&core->queues[task->current_priority], task);
+        core->current = NULL;
+        core_post(core, CORE_EVENT_SUSPEND, task);
+    } else {
+        core_post(core, CORE_EVENT_RUNNING, task);
+    }
+}
+
+static void multicore_run_range(CorePhase phase, int thread) {
+    int first = (int)((long long)thread * s_core_count / s_thread_count);
+    int last = (int)((long long)(thread + 1) * s_core_count / s_thread_count);
+    for (int c = first; c < last; c++) {
+        if (phase == CORE_PHASE_DISPATCH) {
+            core_dispatch_own(&s_cores[c]);
+        } else {
+            core_execute(&s_cores[c]);
+        }
+    }
+}
+
+static void* multicore_worker_main(void* arg) {
+    int thread = (int)(intptr_t)arg;
+
+    // Baslayan is parcacigi sayisi belli olup bariyer kurulana kadar bekle
+    pthread_mutex_lock(&s_start_lock);
+    pthread_mutex_unlock(&s_start_lock);
+    if (s_start_failed) return NULL;
+
+    for (;;) {
+        pthread_barrier_wait(&s_phase_barrier);
+        if (s_phase == CORE_PHASE_EXIT) break;
+        multicore_run_range(s_phase, thread);
+        pthread_barrier_wait(&s_phase_barrier);
+    }
+    return NULL;
+}
+
+// Fazi tum is parcaciklarinda calistir; cagiran is parcacigi 0. bolumu isler
+static void multicore_run_phase(CorePhase phase) {
+    if (s_workers == NULL) {
+        multicore_run_range(phase, 0);
+        return;
+    }
+    s_phase = phase;
+    pthread_barrier_wait(&s_phase_barrier);
+    if (phase == CORE_PHASE_EXIT) return;
+    multicore_run_range(phase, 0);
+    pthread_barrier_wait(&s_phase_barrier);
+}
+
+static int multicore_start_workers(void) {
+    int threads = s_sim_threads < s_core_count ? s_sim_threads : s_core_count;
+    s_thread_count = 1;
+    if (threads <= 1) return 0;
+
+    s_workers = calloc((size_t)threads, sizeof(pthread_t));
+    if (s_workers == NULL) return -1;
+
+    pthread_mutex_lock(&s_start_lock);
+#ifndef _WIN32
+    // Tick sinyalleri sadece FreeRTOS is parcaciklarina gitmeli: maske yeni is parcaciklarina miras kalir
+    sigset_t all_signals, old_signals;
+    sigfillset(&all_signals);
+    pthread_sigmask(SIG_BLOCK, &all_signals, &old_signals);
+#endif
+    int started = 1;
+    while (started < threads &&
+           pthread_create(&s_workers[started], NULL, multicore_worker_main, (void*)(intptr_t)started) == 0) {
+        started++;
+    }
+#ifndef _WIN32
+    pthread_sigmask(SIG_SETMASK, &old_signals, NULL);
+#endif
+
+    // Baslayamayan is parcacigi olursa cekirdekler baslayanlar arasinda bolunur
+    if (started > 1 && pthread_barrier_init(&s_phase_barrier, NULL, (unsigned)started) != 0) {
+        s_start_failed = 1;
+    }
+    s_thread_count = s_start_failed ? 1 : started;
+    pthread_mutex_unlock(&s_start_lock);
+
+    if (s_start_failed || started == 1) {
+        for (int t = 1; t < started; t++) {
+            pthread_join(s_workers[t], NULL);
+        }
+        free(s_workers);
+        s_workers = NULL;
+        return -1;
+    }
+    return started == threads ? 0 : -1;
+}
+
+static void multicore_stop_workers(void) {
+    if (s_workers == NULL) return;
+    multicore_run_phase(CORE_PHASE_EXIT);
+    for (int t = 1; t < s_thread_count; t++) {
+        pthread_join(s_workers[t], NULL);
+    }
+    pthread_barrier_destroy(&s_phase_barrier);
+    free(s_workers);
+    s_workers = NULL;
+}
+
+// Adim basina en yogun ve en bos cekirdek arasindaki yuk farkini biriktir
+static void multicore_sample_balance(void) {
+    int min_load = core_load(&s_cores[0]);
+    int max_load = min_load;
+    for (int c = 1; c < s_core_count; c++) {
+        int load = core_load(&s_cores[c]);
+        if (load < min_load) min_load = load;
+        if (load > max_load) max_load = load;
+    }
+    s_spread_sum += max_load - min_load;
+}
+
+void multicore_run(int last_arrival) {
+    s_cores = calloc((size_t)s_core_count, sizeof(SimCore));
+    s_core_queues = calloc((size_t)s_core_count * MAX_PRIORITY_LEVEL, sizeof(DynamicQueue));
+    if (s_cores == NULL || s_core_queues == NULL) {
+        printf("[HATA] Cekirdekler icin bellek ayrilamadi (%d cekirdek)\n", s_core_count);
+        return;
+    }
+    for (int c = 0; c < s_core_count; c++) {
+        s_cores[c].queues = &s_core_queues[(size_t)c * MAX_PRIORITY_LEVEL];
+        s_cores[c].speed = s_core_speeds != NULL ? s_core_speeds[c] : SPEED_SCALE;
+    }
+    scheduler_set_extra_queues(s_core_queues, s_core_count * MAX_PRIORITY_LEVEL);
+
+    if (multicore_start_workers() != 0) {
+        printf("[HATA] Simulasyon is parcaciklari baslatilamadi, %d is parcacigiyla devam ediliyor\n",
+               s_thread_count);
+    }
+
+    multicore_distribute_arrivals();
+
+    for (;;) {
+        check_timeouts();
+
+        // Bosta cekirdekler once kendi kuyruklarindan (paralel), kalanlar komsudan (seri) alir
+        PROFILE_BEGIN(PROFILE_DISPATCH);
+        multicore_run_phase(CORE_PHASE_DISPATCH);
+        multicore_commit_events();
+        multicore_steal();
+        PROFILE_END(PROFILE_DISPATCH);
+
+        int running = 0;
+        for (int c = 0; c < s_core_count; c++) {
+            if (s_cores[c].current != NULL) running++;
+        }
+
+        // Hicbir cekirdekte calisacak gorev yok
+        if (running == 0) {
+            if (g_completed_tasks >= g_task_count) break;
+            if (g_current_time > last_arrival + MAX_TASK_TIME + 10) break;
+            wait_quantum();
+            g_current_time++;
+            s_total_steps++;
+            multicore_distribute_arrivals();
+            multicore_sample_balance();
+            continue;
+        }
+
+        // Varislar calisan gorevleri etkilemez; kesme kararindan once kuyruklarda olmalari yeterli
+        wait_quantum();
+        g_current_time++;
+        s_total_steps++;
+        multicore_distribute_arrivals();
+
+        // Tum cekirdekler ayni quantum'u calisir (paralel), olaylar cekirdek sirasiyla islenir
+        PROFILE_BEGIN(PROFILE_DISPATCH);
+        multicore_run_phase(CORE_PHASE_EXECUTE);
+        PROFILE_END(PROFILE_DISPATCH);
+        multicore_commit_events();
+        multicore_sample_balance();
+    }
+
+    multicore_stop_workers();
+}
+
+void multicore_print_report(void) {
+    if (!multicore_enabled() || s_cores == NULL) return;
+
+    printf("\n=============== Cekirdek Raporu ===============\n");
+    printf("%-8s %5s %9s %8s %7s %8s %10s %7s %10s\n",
+           "cekirdek", "hiz", "kullanim", "calisma", "gorev", "calinan", "kaptirilan", "isinma", "enerji");
+
+    long long busy_total = 0;
+    long long busy_max = 0;
+    long long migrations = 0;
+    double energy_total = 0.0;
+    for (int c = 0; c < s_core_count; c++) {
+        const SimCore* core = &s_cores[c];
+        // Dinamik guc ~ f^3: 1.0 hizda bir mesgul quantum = 1 birim
+        double speed = (double)core->speed / SPEED_SCALE;
+        double energy = (double)core->busy_quanta * speed * speed * speed;
+        printf("%-8d %5.2f %8.1f%% %8lld %7d %8d %10d %7lld %10.1f\n",
+               c, speed, s_total_steps > 0 ? 100.0 * (double)core->busy_quanta / (double)s_total_steps : 0.0,
+               core->busy_quanta, core->dispatches, core->steals, core->stolen, core->warmup_quanta, energy);
+        energy_total += energy;
+        migrations += core->migrations;
+        busy_total += core->busy_quanta;
+        if (core->busy_quanta > busy_max) busy_max = core->busy_quanta;
+    }
+
+    // Dengesizlik: en yogun cekirdegin calisma suresinin ortalamaya orani - 1
+    double busy_avg = (double)busy_total / (double)s_core_count;
+    printf("\nCekirdek sayisi         : %d\n", s_core_count);
+    printf("Ortalama kullanim       : %.1f%%\n",
+           s_total_steps > 0 ? 100.0 * busy_avg / (double)s_total_steps : 0.0);
+    printf("Yerlesim                : %s\n", s_placement == PLACEMENT_SPEED ? "speed" : "home");
+    printf("Goreli enerji           : %.1f\n", energy_total);
+    printf("Is calma                : %lld\n", s_steals);
+    printf("Goc (sicak gorev)       : %lld (bedel %d quantum, yakinlik %s)\n",
+           migrations, s_migration_cost, s_affinity ? "acik" : "kapali");
+    printf("Yuk dengesizligi        : %.1f%%\n",
+           busy_avg > 0.0 ? 100.0 * ((double)busy_max / busy_avg - 1.0) : 0.0);
+    printf("Ort. yuk farki (adim)   : %.2f gorev\n",
+           s_total_steps > 0 ? (double)s_spread_sum / (double)s_total_steps : 0.0);
+    fflush(stdout);
+}
@@ -0,0 +1,179 @@
+// Donanim performans sayaclari (perf_event_open, sadece Linux)
+//
+// --perf-counters ile yukleme, simulasyon ve rapor fazlari etrafinda cycles,
+// instructions, LLC miss ve branch miss sayilir; karsilastirma icin task-clock ve
+// sayfa hatasi yazilim sayaclari da acilir. Sayaclar fazi calistiran is parcacigi
+// icin (pid = 0) ve sadece kullanici alaninda sayar; boylece FreeRTOS tick is
+// parcacigi olcume karismaz. Desteklenmeyen sayaclar (sanal makinede PMU yoksa)
+// raporda "-" olarak gorunur.
+
+#define _GNU_SOURCE
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <errno.h>
+
+#include "scheduler.h"
+
+#define PERF_COUNTER_COUNT      6
+
+// Faz sonucu: olculemeyen sayaclar gecersiz isaretlenir
+typedef struct {
+    uint64_t values[PERF_COUNTER_COUNT];
+    int valid[PERF_COUNTER_COUNT];
+    int measured;
+} PerfPhaseResult;
+
+static const char* PERF_PHASE_NAMES[PERF_PHASE_COUNT] = { "yukleme", "simulasyon", "rapor" };
+static const char* PERF_COUNTER_NAMES[PERF_COUNTER_COUNT] = {
+    "cycles", "instructions", "LLC miss", "branch miss", "task-clock (ns)", "sayfa hatasi"
+};
+
+static int s_perf_enabled = 0;
+static int s_perf_open_error = 0;       // Acilamayan ilk sayacin errno degeri
+static PerfPhaseResult s_perf_results[PERF_PHASE_COUNT];
+
+#ifdef __linux__
+
+typedef struct {
+    uint32_t type;
+    uint64_t config;
+} PerfCounterSpec;
+
+static const PerfCounterSpec PERF_COUNTER_SPECS[PERF_COUNTER_COUNT] = {
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },     // Cogu islemcide son seviye onbellek
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+    { PERF_TYPE_SOFTWARE, PERF_COUNT_SW_TASK_CLOCK },
+    { PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS },
+};
+
+// Fazlar ic ice girmez: tek bir acik sayac seti yeterlidir
+static int s_perf_fds[PERF_COUNTER_COUNT];
+static int s_perf_active_phase = -1;
+
+static int perf_open_counter(const PerfCounterSpec* spec) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = spec->type;
+    attr.config = spec->config;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;    // perf_event_paranoid=2 ile de acilabilsin
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+int perf_counters_enable(void) {
+    s_perf_enabled = 1;
+    memset(s_perf_results, 0, sizeof(s_perf_results));
+    return 0;
+}
+
+void perf_counters_begin(PerfPhase phase) {
+    if (!s_perf_enabled || s_perf_active_phase >= 0) return;
+
+    for (int i = 0; i < PERF_COUNTER_COUNT; i++) {
+        s_perf_fds[i] = perf_open_counter(&PERF_COUNTER_SPECS[i]);
+        if (s_perf_fds[i] < 0 && s_perf_open_error == 0) s_perf_open_error = errno;
+    }
+    s_perf_active_phase = phase;
+    for (int i = 0; i < PERF_COUNTER_COUNT; i++) {
+        if (s_perf_fds[i] < 0) continue;
+        ioctl(s_perf_fds[i], PERF_EVENT_IOC_RESET, 0);
+        ioctl(s_perf_fds[i], PERF_EVENT_IOC_ENABLE, 0);
+    }
+}
+
+void perf_counters_end(PerfPhase phase) {
+    if (!s_perf_enabled || s_perf_active_phase != (int)phase) return;
+
+    PerfPhaseResult* result = &s_perf_results[phase];
+    for (int i = 0; i < PERF_COUNTER_COUNT; i++) {
+        if (s_perf_fds[i] < 0) continue;
+        ioctl(s_perf_fds[i], PERF_EVENT_IOC_DISABLE, 0);
+
+        // deger, etkin sure, calisma suresi: sayac paylasildiysa olceklenir
+        uint64_t data[3];
+        if (read(s_perf_fds[i], data, sizeof(data)) == (ssize_t)sizeof(data)) {
+            uint64_t value = data[0];
+            if (data[2] > 0 && data[2] < data[1]) {
+                value = (uint64_t)((double)value * (double)data[1] / (double)data[2]);
+            }
+            result->values[i] = value;
+            result->valid[i] = (data[2] > 0);
+        }
+        close(s_perf_fds[i]);
+    }
+    result->measured = 1;
+    s_perf_active_phase = -1;
+}
+
+#else
+
+int perf_counters_enable(void) {
+    printf("[HATA] Donanim sayaclari sadece Linux'ta desteklenir\n");
+    return -1;
+}
+
+void perf_counters_begin(PerfPhase phase) {
+    (void)phase;
+}
+
+void perf_counters_end(PerfPhase phase) {
+    (void)phase;
+}
+
+#endif
+
+static void perf_print_value(const PerfPhaseResult* result, int counter) {
+    if (!result->measured || !result->valid[counter]) {
+        printf(" %16s", "-");
+    } else {
+        printf(" %16llu", (unsigned long long)result->values[counter]);
+    }
+}
+
+// Turetilmis oran: pay/payda * olcek, iki sayac da olculduyse
+static void perf_print_ratio(const PerfPhaseResult* result, int num, int den, double scale) {
+    if (!result->measured || !result->valid[num] || !result->valid[den] || result->values[den] == 0) {
+        printf(" %16s", "-");
+    } else {
+        printf(" %16.3f", (double)result->values[num] / (double)result->values[den] * scale);
+    }
+}
+
+void perf_counters_print(void) {
+    if (!s_perf_enabled) return;
+
+    printf("\nDonanim sayaclari (kullanici alani, fazi calistiran is parcacigi)\n");
+    printf("%-18s", "sayac");
+    for (int p = 0; p < PERF_PHASE_COUNT; p++) printf(" %16s", PERF_PHASE_NAMES[p]);
+    printf("\n");
+
+    for (int i = 0; i < PERF_COUNTER_COUNT; i++) {
+        printf("%-18s", PERF_COUNTER_NAMES[i]);
+        for (int p = 0; p < PERF_PHASE_COUNT; p++) perf_print_value(&s_perf_results[p], i);
+        printf("\n");
+    }
+
+    // IPC ve 1000 komut basina kacirma
+    printf("%-18s", "IPC");
+    for (int p = 0; p < PERF_PHASE_COUNT; p++) perf_print_ratio(&s_perf_results[p], 1, 0, 1.0);
+    printf("\n%-18s", "LLC miss / 1k kmt");
+    for (int p = 0; p < PERF_PHASE_COUNT; p++) perf_print_ratio(&s_perf_results[p], 2, 1, 1000.0);
+    printf("\n%-18s", "branch miss / 1k");
+    for (int p = 0; p < PERF_PHASE_COUNT; p++) perf_print_ratio(&s_perf_results[p], 3, 1, 1000.0);
+    printf("\n");
+    if (s_perf_open_error != 0) {
+        printf("Acilamayan sayaclar '-' ile gosterildi: %s\n", strerror(s_perf_open_error));
+    }
+    fflush(stdout);
+}
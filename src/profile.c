@@ -0,0 +1,78 @@
+// Faz profili: simulasyon dongusunun hangi asamada zaman harcadigini olcer
+//
+// Sadece PROFILE=1 ile (SIM_PROFILE tanimli) derlenir; aksi halde PROFILE_* makrolari
+// bos ifadeye donusur ve bu dosya derlemeye katilmaz. Fazlar ic ice olabilir
+// (ornegin zaman asimi kontrolu icindeki cikti); her faz sadece kendi suresini
+// (ic fazlar haric) biriktirir, boylece toplamlar duvar saati suresine esittir.
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <time.h>
+
+#include "scheduler.h"
+
+#define PROFILE_STACK_DEPTH     16
+
+typedef struct {
+    long long calls;
+    long long total_ns;         // Ic fazlar haric gecen sure
+} ProfileCounter;
+
+static const char* PROFILE_PHASE_NAMES[PROFILE_PHASE_COUNT] = {
+    "yukleme", "dongu (diger)", "varis kontrolu", "zaman asimi", "gorev secimi",
+    "cikti", "quantum bekleme", "durum kaydi", "rapor"
+};
+
+static ProfileCounter s_counters[PROFILE_PHASE_COUNT];
+static int s_stack[PROFILE_STACK_DEPTH];
+static int s_depth = 0;
+static long long s_segment_start = 0;   // Yigin tepesindeki fazin son devam ettigi an
+
+static long long profile_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+void profile_begin(ProfilePhase phase) {
+    long long now = profile_now_ns();
+    if (s_depth > 0) {
+        s_counters[s_stack[s_depth - 1]].total_ns += now - s_segment_start;  // Ust fazi duraklat
+    }
+    if (s_depth < PROFILE_STACK_DEPTH) {
+        s_stack[s_depth] = phase;
+    }
+    s_depth++;
+    s_counters[phase].calls++;
+    s_segment_start = now;
+}
+
+void profile_end(ProfilePhase phase) {
+    long long now = profile_now_ns();
+    if (s_depth == 0) return;
+    s_depth--;
+    if (s_depth < PROFILE_STACK_DEPTH) {
+        s_counters[s_stack[s_depth]].total_ns += now - s_segment_start;
+    } else {
+        s_counters[phase].total_ns += now - s_segment_start;
+    }
+    s_segment_start = now;  // Ust faz kaldigi yerden devam eder
+}
+
+void profile_print_report(void) {
+    long long total_ns = 0;
+    for (int i = 0; i < PROFILE_PHASE_COUNT; i++) total_ns += s_counters[i].total_ns;
+
+    // Simulasyon ciktisi bozulmasin diye rapor standart hataya yazilir
+    fprintf(stderr, "\n=============== Faz Profili ===============\n");
+    fprintf(stderr, "%-16s %12s %12s %10s %6s\n", "faz", "cagri", "sure(ms)", "ort(ns)", "pay");
+    for (int i = 0; i < PROFILE_PHASE_COUNT; i++) {
+        const ProfileCounter* c = &s_counters[i];
+        if (c->calls == 0) continue;
+        fprintf(stderr, "%-16s %12lld %12.3f %10.0f %5.1f%%\n",
+                PROFILE_PHASE_NAMES[i], c->calls, c->total_ns / 1e6,
+                (double)c->total_ns / (double)c->calls,
+                total_ns > 0 ? 100.0 * (double)c->total_ns / (double)total_ns : 0.0);
+    }
+    fprintf(stderr, "%-16s %12s %12.3f\n", "toplam", "", total_ns / 1e6);
+}
@@ -3,31 +3,72 @@
 #include "scheduler.h"
 
 // Extern degiskenler (main.c'de tanimlandi)
-extern TaskInfo g_tasks[MAX_TASKS];
+extern TaskInfo* g_tasks;
+extern int g_task_capacity;
 extern int g_task_count;
 extern int g_completed_tasks;
 extern int g_current_time;
 extern int g_context_switches;
+extern int g_fast_mode;
+extern int g_sim_clock;
 extern DynamicQueue g_priority_queues[MAX_PRIORITY_LEVEL];
 extern const char* COLOR_PALETTE[];
 
-// Kuyruk fonksiyonlari
-void init_queues(void) {
-    for (int i = 0; i < MAX_PRIORITY_LEVEL; i++) {
-        g_priority_queues[i].count = 0;
-        for (int j = 0; j < MAX_TASKS; j++) {
-            g_priority_queues[i].tasks[j] = NULL;
-        }
-    }
+// Varis sirasina gore gorev indeksleri: her zaman adiminda tum gorevleri taramak yerine
+// imlecten itibaren sadece varis zamani gelenlere bakilir
+static int* s_arrival_order = NULL;
+static int s_arrival_capacity = 0;
+static int s_arrival_cursor = 0;
+
+// Oncelik seviyesi kuyruk araliginin disinda kalan (hicbir kuyruga giremeyen) gorevler.
+// Calismazlar ama zaman asimi kontrolune tabidirler.
+static DynamicQueue s_unqueued_tasks;
+
+// Cok cekirdekli modda cekirdeklerin kendi kuyruklari (zaman asimi kontrolune dahil)
+static DynamicQueue* s_extra_queues = NULL;
+static int s_extra_queue_count = 0;
+
+// Zaman asimi adaylari (gorev id sirasina gore islenir)
+static TaskInfo** s_timeout_candidates = NULL;
+static int s_timeout_capacity = 0;
+static int s_timeout_count = 0;     // Son check_timeouts cagrisinda sonlanan gorev sayisi
+
+// Gorev dizisini gerektiginde buyut
+int tasks_reserve(int capacity) {
+    if (capacity <= g_task_capacity) return 0;
+    int new_capacity = g_task_capacity ? g_task_capacity : INITIAL_TASK_CAPACITY;
+    while (new_capacity < capacity) new_capacity *= 2;
+
+    TaskInfo* tasks = realloc(g_tasks, (size_t)new_capacity * sizeof(TaskInfo));
+    if (tasks == NULL) return -1;
+    g_tasks = tasks;
+    g_task_capacity = new_capacity;
+    return 0;
 }
 
-void queue_add(int priority, TaskInfo* task) {
-    if (priority < 0 || priority >= MAX_PRIORITY_LEVEL || task == NULL) return;
-    DynamicQueue* q = &g_priority_queues[priority];
-    if (q->count >= MAX_TASKS) return;
+// Kuyruk kapasitesini gerektiginde buyut
+static int queue_reserve(DynamicQueue* q, int needed) {
+    if (needed <= q->capacity) return 0;
+    int capacity = q->capacity ? q->capacity : INITIAL_QUEUE_CAPACITY;
+    while (capacity < needed) capacity *= 2;
+
+    TaskInfo** tasks = realloc(q->tasks, (size_t)capacity * sizeof(TaskInfo*));
+    if (tasks == NULL) return -1;
+    q->tasks = tasks;
+    q->capacity = capacity;
+    return 0;
+}
+
+static void queue_clear(DynamicQueue* q) {
+    q->count = 0;
+    q->expired_count = 0;
+}
+
+// Sirali ekleme: last_active_time (eski once), sonra task_id
+// Bu siralamayla en eski aktif olan gorev once calisir
+void queue_insert_sorted(DynamicQueue* q, TaskInfo* task) {
+    if (queue_reserve(q, q->count + 1) != 0) return;
 
-    // Sirali ekleme: last_active_time (eski once), sonra task_id
-    // Bu siralamayla en eski aktif olan gorev once calisir
     int pos = q->count;
     while (pos > 0) {
         TaskInfo* prev = q->tasks[pos - 1];
@@ -41,28 +82,54 @@ void queue_add(int priority, TaskInfo* task) {
     q->count++;
 }
 
+// Kuyruk fonksiyonlari
+void init_queues(void) {
+    // Ayrilan bellek korunur, sadece kuyruklar bosaltilir
+    for (int i = 0; i < MAX_PRIORITY_LEVEL; i++) {
+        queue_clear(&g_priority_queues[i]);
+    }
+    queue_clear(&s_unqueued_tasks);
+    s_arrival_cursor = 0;
+}
+
+void queue_add(int priority, TaskInfo* task) {
+    if (priority < 0 || priority >= MAX_PRIORITY_LEVEL || task == NULL) return;
+    queue_insert_sorted(&g_priority_queues[priority], task);
+}
+
 TaskInfo* queue_remove(int priority) {
     if (priority < 0 || priority >= MAX_PRIORITY_LEVEL) return NULL;
-    DynamicQueue* q = &g_priority_queues[priority];
-    
-    // Sonlanmis gorevleri atla
-    while (q->count > 0 && q->tasks[0] != NULL && q->tasks[0]->state == TASK_STATE_TERMINATED) {
-        // Sonlanmis gorevi kuyruktan cikar
-        for (int i = 0; i < q->count - 1; i++) {
-            q->tasks[i] = q->tasks[i + 1];  // Sola kaydir
-        }
-        q->tasks[--q->count] = NULL;
-    }
-    
-    if (q->count == 0) return NULL;  // Kuyruk bos
-    
-    // Bas gorev alinir (FIFO)
-    TaskInfo* task = q->tasks[0];
-    for (int i = 0; i < q->count - 1; i++) {
-        q->tasks[i] = q->tasks[i + 1];  // Tum gorevleri sola kaydir
-    }
-    q->tasks[--q->count] = NULL;
-    
+    return queue_pop_head(&g_priority_queues[priority]);
+}
+
+TaskInfo* queue_pop_head(DynamicQueue* q) {
+    // Sonlanmis gorevleri atla (zaman asimina ugrayanlar kuyrugun basinda birikir)
+    int skip = 0;
+    while (skip < q->count && q->tasks[skip] != NULL && q->tasks[skip]->state == TASK_STATE_TERMINATED) {
+        skip++;
+    }
+
+    if (skip == q->count) {  // Kuyruk bos
+        queue_clear(q);
+        return NULL;
+    }
+
+    // Bas gorev alinir (FIFO), kalanlar tek seferde sola kaydirilir
+    TaskInfo* task = q->tasks[skip];
+    int removed = skip + 1;
+    memmove(q->tasks, q->tasks + removed, (size_t)(q->count - removed) * sizeof(TaskInfo*));
+    q->count -= removed;
+    q->expired_count = 0;
+
+    return task;
+}
+
+TaskInfo* queue_remove_at(DynamicQueue* q, int index) {
+    if (index < 0 || index >= q->count) return NULL;
+    TaskInfo* task = q->tasks[index];
+    memmove(q->tasks + index, q->tasks + index + 1, (size_t)(q->count - index - 1) * sizeof(TaskInfo*));
+    q->count--;
+    if (index < q->expired_count) q->expired_count--;
     return task;
 }
 
@@ -83,6 +150,7 @@ int find_highest_priority_queue(void) {
 // Yardimci fonksiyonlar
 void print_task_status(TaskInfo* task, const char* status) {
     if (task == NULL) return;
+    PROFILE_BEGIN(PROFILE_OUTPUT);
     printf("%s%7.4f sn %-8s %-12s (id:%04d oncelik:%d kalan sure:%2d sn)%s\n",
            task->color_code,
            (float)g_current_time,
@@ -92,115 +160,226 @@ void print_task_status(TaskInfo* task, const char* status) {
            task->current_priority,
            task->remaining_time,
            COLOR_RESET);
-    fflush(stdout);
+    trace_record(task, status);
+    if (!g_fast_mode && !g_sim_clock) {
+        fflush(stdout);  // Gercek zamanli modda satirlar aninda gorunsun
+    }
+    PROFILE_END(PROFILE_OUTPUT);
 }
 
 // Gorev yonetim fonksiyonlari
 void check_arriving_tasks(void) {
-    // Suanki zamanda gelmesi gereken gorevleri kuyruklara ekle
-    for (int i = 0; i < g_task_count; i++) {
-        TaskInfo* task = &g_tasks[i];
-        
-        if (task->arrival_time == g_current_time && task->state == TASK_STATE_WAITING) {
+    PROFILE_BEGIN(PROFILE_ARRIVALS);
+    // Suanki zamanda gelmesi gereken gorevleri kuyruklara ekle (varis sirasiyla)
+    while (s_arrival_cursor < g_task_count) {
+        TaskInfo* task = &g_tasks[s_arrival_order[s_arrival_cursor]];
+        if (task->arrival_time > g_current_time) break;
+        s_arrival_cursor++;
+
+        if (task->state == TASK_STATE_WAITING) {
             task->state = TASK_STATE_READY;  // Hazir durumuna getir
-            queue_add(task->current_priority, task);  // Uygun kuyruğa ekle
+            if (task->current_priority < MAX_PRIORITY_LEVEL) {
+                queue_add(task->current_priority, task);  // Uygun kuyruğa ekle
+            } else {
+                queue_insert_sorted(&s_unqueued_tasks, task);  // Kuyruga giremez, sadece zaman asimi izlenir
+            }
         }
     }
+    PROFILE_END(PROFILE_ARRIVALS);
 }
 
-void check_timeouts(void) {
-    // Her gorevi kontrol et, timeout olan varsa sonlandir
-    for (int i = 0; i < g_task_count; i++) {
-        TaskInfo* task = &g_tasks[i];
-        
-        // Sonlanan, daha once timeout basilan veya henuz gelmemis gorevleri atla
-        if (task->state == TASK_STATE_TERMINATED) continue;
-        if (task->timeout_printed) continue;
-        if (task->state == TASK_STATE_WAITING) continue;
-        if (task->state == TASK_STATE_RUNNING) continue;  // Calisan gorev timeout olmaz
-        
-        int timeout_time;
-        
-        // last_active_time her calistiginda guncellenir, 20 sn sonrasi timeout
-        timeout_time = task->last_active_time + MAX_TASK_TIME;
-        
-        if (g_current_time >= timeout_time) {
-            print_task_status(task, "zamanasimi");
-            task->timeout_printed = 1;
-            task_terminate(task, g_current_time);
-            g_completed_tasks++;
+static int compare_task_id(const void* a, const void* b) {
+    const TaskInfo* ta = *(TaskInfo* const*)a;
+    const TaskInfo* tb = *(TaskInfo* const*)b;
+    return (ta->task_id > tb->task_id) - (ta->task_id < tb->task_id);
+}
+
+// Kuyruk basindaki suresi dolmus gorevleri aday listesine ekle.
+// Kuyruklar last_active_time'a gore sirali oldugundan suresi dolanlar hep bastadir;
+// onceki turlarda sonlandirilanlar (expired_count) tekrar taranmaz.
+static int collect_expired(DynamicQueue* q, int count) {
+    int k = q->expired_count;
+    while (k < q->count && q->tasks[k]->last_active_time + MAX_TASK_TIME <= g_current_time) {
+        TaskInfo* task = q->tasks[k];
+        k++;
+        if (task->state == TASK_STATE_TERMINATED || task->timeout_printed) continue;
+        if (task->state == TASK_STATE_WAITING || task->state == TASK_STATE_RUNNING) continue;
+
+        if (count >= s_timeout_capacity) {
+            int capacity = s_timeout_capacity ? s_timeout_capacity * 2 : INITIAL_QUEUE_CAPACITY;
+            TaskInfo** candidates = realloc(s_timeout_candidates, (size_t)capacity * sizeof(TaskInfo*));
+            if (candidates == NULL) break;
+            s_timeout_candidates = candidates;
+            s_timeout_capacity = capacity;
         }
+        s_timeout_candidates[count++] = task;
+    }
+    q->expired_count = k;  // Bu noktaya kadar hepsi sonlandirilmis olacak
+    return count;
+}
+
+void check_timeouts(void) {
+    PROFILE_BEGIN(PROFILE_TIMEOUTS);
+    // last_active_time her calistiginda guncellenir, 20 sn sonrasi timeout
+    int count = 0;
+    for (int i = 0; i < MAX_PRIORITY_LEVEL; i++) {
+        count = collect_expired(&g_priority_queues[i], count);
+    }
+    count = collect_expired(&s_unqueued_tasks, count);
+    for (int i = 0; i < s_extra_queue_count; i++) {
+        count = collect_expired(&s_extra_queues[i], count);
+    }
+
+    // Mesajlar gorev sirasiyla basilir (tum gorevleri tarayan eski davranisla ayni)
+    if (count > 1) {
+        qsort(s_timeout_candidates, (size_t)count, sizeof(TaskInfo*), compare_task_id);
+    }
+
+    for (int i = 0; i < count; i++) {
+        TaskInfo* task = s_timeout_candidates[i];
+        print_task_status(task, "zamanasimi");
+        task->timeout_printed = 1;
+        task_terminate(task, g_current_time);
+        g_completed_tasks++;
     }
+    s_timeout_count = count;
+    PROFILE_END(PROFILE_TIMEOUTS);
 }
 
 void demote_priority(TaskInfo* task) {
     if (task == NULL) return;
     if (task->type == TASK_TYPE_REALTIME) return;
-    
+
     // MLFQ: kullanici gorevlerinde onceligi bir seviye dusur
     if (task->current_priority < PRIORITY_LOW) {
         task->current_priority++;
     }
 }
 
+static int compare_arrival(const void* a, const void* b) {
+    const TaskInfo* ta = &g_tasks[*(const int*)a];
+    const TaskInfo* tb = &g_tasks[*(const int*)b];
+    if (ta->arrival_time != tb->arrival_time) return (ta->arrival_time > tb->arrival_time) ? 1 : -1;
+    return (ta->task_id > tb->task_id) - (ta->task_id < tb->task_id);
+}
+
+// Varis sirasi, zaman asimi imlecleri ve kuyruk disi listeyi gorev durumundan yeniden kur.
+// Dosyadan yuklemeden veya durum kaydindan donusten sonra cagrilir.
+int scheduler_rebuild_indexes(void) {
+    if (g_task_count > s_arrival_capacity) {
+        int* order = realloc(s_arrival_order, (size_t)g_task_count * sizeof(int));
+        if (order == NULL) return -1;
+        s_arrival_order = order;
+        s_arrival_capacity = g_task_count;
+    }
+
+    // Giris dosyalari genelde zaten varis sirasindadir; o durumda siralama gerekmez
+    int sorted = 1;
+    for (int i = 0; i < g_task_count; i++) {
+        s_arrival_order[i] = i;
+        if (i > 0 && g_tasks[i].arrival_time < g_tasks[i - 1].arrival_time) sorted = 0;
+    }
+    if (!sorted) {
+        qsort(s_arrival_order, (size_t)g_task_count, sizeof(int), compare_arrival);
+    }
+    s_arrival_cursor = 0;
+
+    // Bastaki sonlanmis gorevler onceki zaman asimi turlarindan kalmistir
+    for (int p = 0; p < MAX_PRIORITY_LEVEL; p++) {
+        DynamicQueue* q = &g_priority_queues[p];
+        q->expired_count = 0;
+        while (q->expired_count < q->count && q->tasks[q->expired_count]->state == TASK_STATE_TERMINATED) {
+            q->expired_count++;
+        }
+    }
+
+    // Kuyruga giremeyen hazir gorevler varis sirasiyla
+    queue_clear(&s_unqueued_tasks);
+    for (int i = 0; i < g_task_count; i++) {
+        TaskInfo* task = &g_tasks[s_arrival_order[i]];
+        if (task->current_priority < MAX_PRIORITY_LEVEL) continue;
+        if (task->state == TASK_STATE_WAITING) continue;
+        queue_insert_sorted(&s_unqueued_tasks, task);
+    }
+    for (int k = 0; k < s_unqueued_tasks.count && s_unqueued_tasks.tasks[k]->state == TASK_STATE_TERMINATED; k++) {
+        s_unqueued_tasks.expired_count = k + 1;
+    }
+    return 0;
+}
+
+int scheduler_arrived_count(void) {
+    return s_arrival_cursor;
+}
+
+TaskInfo* scheduler_arrival_at(int position) {
+    if (position < 0 || position >= g_task_count) return NULL;
+    return &g_tasks[s_arrival_order[position]];
+}
+
+const DynamicQueue* scheduler_unqueued_tasks(void) {
+    return &s_unqueued_tasks;
+}
+
+TaskInfo* const* scheduler_last_timeouts(int* count) {
+    *count = s_timeout_count;
+    return s_timeout_candidates;
+}
+
+void scheduler_set_extra_queues(DynamicQueue* queues, int count) {
+    s_extra_queues = queues;
+    s_extra_queue_count = count;
+}
+
 // Dosya islemleri
-int load_tasks_from_file(const char* filename) {
+static int read_task_file(const char* filename) {
     // giris.txt dosyasini oku ve gorevleri yukle
     FILE* file = fopen(filename, "r");
     if (file == NULL) {
         printf("[HATA] Dosya acilamadi: %s\n", filename);
         return -1;
     }
-    
+
     char line[256];
     int task_id = 0;
-    
+
     // Her satiri oku: arrival_time, priority, burst_time
-    while (fgets(line, sizeof(line), file) != NULL && task_id < MAX_TASKS) {
+    while (fgets(line, sizeof(line), file) != NULL) {
         if (strlen(line) <= 1) continue;  // Bos satirlari atla
-        
+
         int arrival_time, priority, burst_time;
-        
+
         // Satiri parse et (hem bosluklu hem bosluksuz format desteklenir)
         if (sscanf(line, "%d, %d, %d", &arrival_time, &priority, &burst_time) == 3 ||
             sscanf(line, "%d,%d,%d", &arrival_time, &priority, &burst_time) == 3) {
-            
+
             // Gecersiz degerleri atla
             if (priority < 0 || burst_time <= 0 || arrival_time < 0) continue;
-            
-            TaskInfo* task = &g_tasks[task_id];
-
-            task->task_id = task_id;
-            // Gorev isimlendirme haritasi
-            static const int name_map[12] = { 1, 2, 9, 3, 4, 5, 11, 6, 7, 8, 12, 10 };
-            if (task_id < (int)(sizeof(name_map)/sizeof(name_map[0]))) {
-                snprintf(task->task_name, sizeof(task->task_name), "task%d", name_map[task_id]);
-            } else {
-                snprintf(task->task_name, sizeof(task->task_name), "task%d", task_id + 1);
+
+            if (tasks_reserve(task_id + 1) != 0) {
+                printf("[HATA] Gorevler icin bellek ayrilamadi (%d gorev)\n", task_id + 1);
+                fclose(file);
+                return -1;
             }
-            // Gorev bilgilerini ayarla
-            task->arrival_time = arrival_time;
-            task->original_priority = priority;
-            task->current_priority = priority;  // Baslangicta original ile ayni
-            task->burst_time = burst_time;
-            task->remaining_time = burst_time;  // Baslangicta burst ile ayni
-            task->executed_time = 0;
-            task->state = TASK_STATE_WAITING;   // Henuz gelmedi
-            task->type = (priority == PRIORITY_REALTIME) ? TASK_TYPE_REALTIME : TASK_TYPE_USER;
-            task->start_time = -1;              // Henuz baslamadi
-            task->completion_time = -1;         // Henuz bitmedi
-            task->color_code = COLOR_PALETTE[task_id % COLOR_PALETTE_SIZE];  // Renkli cikti icin
-            task->timeout_printed = 0;
-            task->last_active_time = arrival_time;  // Son aktif zaman = varis zamani
-            
+
+            task_init(&g_tasks[task_id], task_id, arrival_time, priority, burst_time);
             task_id++;
         }
     }
-    
+
     fclose(file);
     g_task_count = task_id;
-    
+
+    if (scheduler_rebuild_indexes() != 0) {
+        printf("[HATA] Varis indeksi icin bellek ayrilamadi\n");
+        return -1;
+    }
+
     return task_id;
 }
 
-
+int load_tasks_from_file(const char* filename) {
+    PROFILE_BEGIN(PROFILE_LOAD);
+    int result = read_task_file(filename);
+    PROFILE_END(PROFILE_LOAD);
+    return result;
+}
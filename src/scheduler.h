@@ -7,6 +7,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdarg.h>
+#include <stdint.h>
 
 #include "FreeRTOS.h"
 #include "task.h"
@@ -15,11 +16,22 @@
 #include "timers.h"
 
 // Sabit tanimlamalar
-#define MAX_TASKS               200
+#define INITIAL_TASK_CAPACITY   256     // Gorev dizisi ilk kapasitesi (gerektikce buyur)
+#define INITIAL_QUEUE_CAPACITY  16      // Kuyruk ilk kapasitesi (gerektikce buyur)
 #define MAX_TASK_TIME           20      // Maksimum gorev suresi (timeout)
 #define TIME_QUANTUM_MS         1000    // 1 saniye = 1000 ms
 #define MAX_PRIORITY_LEVEL      20
 #define COLOR_PALETTE_SIZE      25
+#define CHECKPOINT_DEFAULT_INTERVAL 10  // Varsayilan durum kaydi araligi (simulasyon sn)
+#define SPEED_SCALE             1000    // Cekirdek hizi sabit noktasi (1000 = 1.0)
+#define KERNEL_TASK_POOL_DEFAULT 1024   // --kernel-tasks icin statik TCB/yigin yuvasi
+
+// HDR histogram ayarlari: 2^7 alt kova ile her deger en fazla 1/64 (~%1.6) goreli hatayla saklanir
+#define HIST_SUB_BUCKET_BITS    7
+#define HIST_SUB_BUCKET_COUNT   (1 << HIST_SUB_BUCKET_BITS)
+#define HIST_SUB_BUCKET_HALF    (HIST_SUB_BUCKET_COUNT / 2)
+#define HIST_BUCKET_COUNT       (32 - HIST_SUB_BUCKET_BITS + 1)   // int araligi icin yeterli
+#define HIST_COUNTS_LEN         ((HIST_BUCKET_COUNT + 1) * HIST_SUB_BUCKET_HALF)
 
 // Oncelik seviyeleri (0-3)
 #define PRIORITY_REALTIME       0       // Gercek zamanli
@@ -63,14 +75,59 @@ typedef struct {
     const char* color_code;     // Terminal renk kodu
     int timeout_printed;        // Timeout mesaji basildi mi
     int last_active_time;       // Son aktif oldugu zaman
+    int waiting_time;           // Kuyrukta bekleme suresi (sonlaninca hesaplanir)
+    int response_time;          // Varistan ilk calismaya kadar gecen sure (-1: hic calismadi)
+    int turnaround_time;        // Varistan sonlanmaya kadar gecen sure
+    int last_core;              // En son calistigi simule cekirdek (-1: hic calismadi)
+    int partial_work;           // Yavas cekirdekte biriken kesirli is (SPEED_SCALE = 1 sn)
 } TaskInfo;
 
 // Dinamik oncelik kuyrugu yapisi
 typedef struct {
-    TaskInfo* tasks[MAX_TASKS]; // Gorev pointer dizisi
+    TaskInfo** tasks;           // Gorev pointer dizisi (last_active_time, task_id sirali)
     int count;                  // Kuyruktaki gorev sayisi
+    int capacity;               // Ayrilmis kapasite
+    int expired_count;          // Bastaki zaman asimiyla sonlanmis gorev sayisi
 } DynamicQueue;
 
+// Sabit bellekli, logaritmik kovali gecikme histogrami (HDR benzeri)
+typedef struct {
+    uint32_t counts[HIST_COUNTS_LEN];   // Kova sayaclari
+    long long total_count;              // Kaydedilen ornek sayisi
+    int max_value;                      // Gorulen en buyuk deger
+} LatencyHistogram;
+
+// Oncelik seviyesi basina biriktirilen metrikler
+typedef struct {
+    int task_count;             // Sonlanan gorev sayisi
+    int timeout_count;          // Zaman asimina ugrayan gorev sayisi
+    int started_count;          // En az bir kez calisan gorev sayisi
+    long long total_waiting;    // Toplam bekleme suresi
+    long long total_response;   // Toplam yanit suresi (sadece calisanlar)
+    long long total_turnaround; // Toplam donus suresi
+    LatencyHistogram waiting_hist;      // Bekleme suresi dagilimi
+    LatencyHistogram response_hist;     // Yanit suresi dagilimi
+    LatencyHistogram turnaround_hist;   // Donus suresi dagilimi
+} LevelMetrics;
+
+// Sentetik is yuku varis sureci
+typedef enum {
+    ARRIVAL_POISSON,            // Ustel aralikli bagimsiz varislar
+    ARRIVAL_BURSTY              // Ayni saniyede grup halinde gelen varislar
+} ArrivalProcess;
+
+#define WORKLOAD_PRIORITY_COUNT 4       // Uretilen oncelikler: 0 (RT) - 3
+
+// Is yuku ureteci ayarlari
+typedef struct {
+    int task_count;                                     // Uretilecek gorev sayisi
+    uint64_t seed;                                      // PRNG tohumu
+    ArrivalProcess arrival;                             // Varis sureci
+    double rate;                                        // Ortalama varis hizi (gorev/sn)
+    double priority_weights[WORKLOAD_PRIORITY_COUNT];   // Oncelik karisimi agirliklari
+    double burst_alpha;                                 // Pareto sure dagilimi sekil parametresi
+} WorkloadConfig;
+
 // Fonksiyon prototipleri
 
 // Kuyruk yonetim fonksiyonlari
@@ -79,15 +136,40 @@ void queue_add(int priority, TaskInfo* task);        // Kuyruga gorev ekle
 TaskInfo* queue_remove(int priority);                // Kuyruktan gorev al
 int queue_is_empty(int priority);                    // Kuyruk bos mu kontrol et
 int find_highest_priority_queue(void);               // En yuksek oncelikli kuyrugun numarasini bul
+void queue_insert_sorted(DynamicQueue* q, TaskInfo* task); // Herhangi bir kuyruga sirali ekle
+TaskInfo* queue_pop_head(DynamicQueue* q);           // Bastaki calisabilir gorevi al (sonlanmislari atla)
+TaskInfo* queue_remove_at(DynamicQueue* q, int index); // Verilen konumdaki gorevi cikar
 
 // Scheduler yonetim fonksiyonlari
 void check_arriving_tasks(void);                     // Yeni gelen gorevleri kontrol et
 void check_timeouts(void);                           // Zaman asimi kontrolu
 void demote_priority(TaskInfo* task);                // MLFQ: onceligi dusur
+int tasks_reserve(int capacity);                     // Gorev dizisini buyut
+int scheduler_rebuild_indexes(void);                 // Varis/zaman asimi indekslerini yeniden kur
+int scheduler_arrived_count(void);                   // Varis sirasinda islenmis gorev sayisi
+TaskInfo* scheduler_arrival_at(int position);        // Varis sirasindaki gorev
+const DynamicQueue* scheduler_unqueued_tasks(void);  // Kuyruga giremeyen hazir gorevler
+void scheduler_set_extra_queues(DynamicQueue* queues, int count); // Zaman asimi kontrolune ek kuyruklar
+TaskInfo* const* scheduler_last_timeouts(int* count);  // Son zaman asimi kontrolunde sonlananlar (id sirali)
 
 // Cikti fonksiyonlari
 void print_task_status(TaskInfo* task, const char* status);
 
+// Tek cekirdekli dongu kancalari: --kernel-tasks her adimi FreeRTOS gorevlerine yansitir.
+// Verilmeyen kanca cagrilmaz.
+typedef struct {
+    void (*on_dispatch)(TaskInfo* task);     // Secilen gorev baslamadan once
+    void (*on_quantum)(TaskInfo* task);      // Calisan gorev bir quantum calisti (seviye dusmeden once)
+    void (*on_terminate)(TaskInfo* task);    // Biten veya zaman asimina ugrayan gorev
+    void (*on_requeue)(TaskInfo* task);      // Kesilen gorev kuyruga dondu (ayni adimin varislariyla)
+    void (*on_arrivals)(void);               // Yeni varislar kuyruklara eklendi
+    int (*stopped)(void);                    // Simulasyon yarida durdurulmali mi
+} SchedulerHooks;
+
+// Simulasyon dongusu yardimcilari (main.c)
+void wait_quantum(void);                             // Bir quantum bekle (hizli modda beklemez)
+void scheduler_run(int last_arrival, const SchedulerHooks* hooks);  // RT (FCFS) + MLFQ dongusu
+
 // Dosya islemleri
 int load_tasks_from_file(const char* filename);      // Dosyadan gorevleri yukle
 
@@ -95,6 +177,7 @@ int load_tasks_from_file(const char* filename);      // Dosyadan gorevleri yukle
 const char* get_task_state_string(TaskState state);      // Durum enum'unu string'e cevir
 const char* get_task_type_string(TaskType type);          // Tip enum'unu string'e cevir
 void print_task_info(TaskInfo* task);                     // Gorev bilgilerini yazdir
+void task_init(TaskInfo* task, int task_id, int arrival_time, int priority, int burst_time); // Baslangic durumu
 void task_start(TaskInfo* task, int current_time);        // Gorevi basla
 void task_suspend(TaskInfo* task);                        // Gorevi askiya al
 void task_resume(TaskInfo* task);                         // Gorevi devam ettir
@@ -103,4 +186,138 @@ int task_execute(TaskInfo* task);                         // 1 saniye calistir
 int task_is_ready(TaskInfo* task, int current_time);      // Gorev hazir mi
 int task_is_timeout(TaskInfo* task, int current_time);    // Timeout oldu mu
 
+// Histogram fonksiyonlari (histogram.c)
+void histogram_reset(LatencyHistogram* hist);                           // Sayaclari sifirla
+void histogram_record(LatencyHistogram* hist, int value);               // Ornek ekle
+void histogram_merge(LatencyHistogram* dst, const LatencyHistogram* src); // Iki histogrami birlestir
+int histogram_percentile(const LatencyHistogram* hist, double percentile); // Yuzdelik degeri
+
+// Metrik fonksiyonlari (metrics.c)
+void metrics_init(void);                                  // Biriktiricileri sifirla
+void metrics_record_task(TaskInfo* task);                 // Sonlanan gorevin metriklerini ekle
+void metrics_print_report(void);                          // Simulasyon sonu raporunu yazdir
+
+// Serilestirme tamponu (durum kayitlari icin)
+typedef struct {
+    unsigned char* data;
+    size_t len;
+    size_t cap;
+    int error;                  // Bellek yetersizligi
+} SnapshotBuffer;
+
+// Serilestirilmis veri okuma imleci
+typedef struct {
+    const unsigned char* data;
+    size_t len;
+    size_t pos;
+    int error;                  // Kesik veya gecersiz veri
+} SnapshotReader;
+
+// Serilestirme yardimcilari (checkpoint.c)
+int snapshot_reserve(SnapshotBuffer* buf, size_t extra);
+void snapshot_put_uvarint(SnapshotBuffer* buf, uint64_t value);
+void snapshot_put_varint(SnapshotBuffer* buf, int64_t value);
+void snapshot_put_string(SnapshotBuffer* buf, const char* text);
+uint64_t snapshot_get_uvarint(SnapshotReader* rd);
+int64_t snapshot_get_varint(SnapshotReader* rd);
+int snapshot_get_int(SnapshotReader* rd, int min_value, int max_value);
+void snapshot_get_string(SnapshotReader* rd, char* out, size_t out_size);
+void snapshot_put_task(SnapshotBuffer* buf, const TaskInfo* task);  // Gorevin tum durumu
+void snapshot_get_task(SnapshotReader* rd, TaskInfo* task);
+void snapshot_put_queues(SnapshotBuffer* buf);                       // Hazir kuyruklari
+int snapshot_get_queues(SnapshotReader* rd);
+void snapshot_put_metrics(SnapshotBuffer* buf);                      // Metrik biriktiricileri
+void snapshot_get_metrics(SnapshotReader* rd);
+
+// Durum kaydi fonksiyonlari (checkpoint.c)
+int checkpoint_init(const char* path, int interval);      // Periyodik kaydi ve yazici is parcacigini baslat
+void checkpoint_maybe_save(void);                         // Zamani geldiyse durumu kaydet (dongu basinda)
+void checkpoint_shutdown(void);                           // Bekleyen yazmayi bitir ve kapat
+int checkpoint_load(const char* path);                    // Kayittan durumu geri yukle
+
+// Ne-olursa analizi (whatif.c)
+int snapshot_log_open(const char* path, int interval);    // Hafif kayit gunlugunu baslat
+void snapshot_log_maybe_record(void);                     // Zamani geldiyse degisen durumu kaydet
+void snapshot_log_close(void);                            // Gunlugu kapat
+int whatif_prepare(const char* path, int* resumed);       // Duzenlenmis is yukunu uygun kayda uygula
+
+// Olay izi ve karsilastirma (trace.c)
+int trace_open(const char* path);                         // Ikili olay izini baslat
+void trace_record(const TaskInfo* task, const char* status); // Durum satirini ize ekle
+void trace_close(void);                                   // Izi kapat
+int compare_traces(const char* path_a, const char* path_b); // 0 ayni, 1 farkli, -1 hata
+
+// Is yuku ureteci ve olceklenebilirlik testi (workload.c)
+void workload_default_config(WorkloadConfig* config);     // Varsayilan ayarlar
+int workload_parse_arrival(const char* text, WorkloadConfig* config); // "poisson" / "bursty"
+int workload_parse_mix(const char* text, WorkloadConfig* config);     // "w0,w1,w2,w3"
+int workload_write(const WorkloadConfig* config, FILE* out);          // giris.txt biciminde yaz
+int workload_generate_file(const WorkloadConfig* config, const char* path);
+int workload_scale_benchmark(const WorkloadConfig* config, int max_tasks); // 10^3..max_tasks tarama
+
+// Cok cekirdekli simulasyon (multicore.c)
+typedef enum {
+    PLACEMENT_HOME,             // Gorev ev cekirdegine (id % N)
+    PLACEMENT_SPEED             // RT gorevler en hizli cekirdeklere
+} PlacementPolicy;
+
+int multicore_configure(int cores);                       // --cores: cekirdek sayisini ayarla
+int multicore_set_migration(int cost, int affinity);      // Goc bedeli (quantum) ve yakinlik duyarli calma
+int multicore_set_speeds(const char* text);               // "1.0,0.4,...": cekirdek hizlari
+int multicore_set_placement(const char* text);            // "home" / "speed"
+int multicore_set_threads(int threads);                   // Paralel simulasyon icin host is parcacigi sayisi
+int multicore_enabled(void);                              // Birden fazla cekirdek var mi
+void multicore_run(int last_arrival);                     // Cekirdek basina kuyruklu zamanlama dongusu
+void multicore_print_report(void);                        // Cekirdek kullanim/goc/dengesizlik raporu
+
+// Gercek FreeRTOS gorevleri (kernel_tasks.c)
+void kernel_tasks_enable(void);                           // --kernel-tasks
+int kernel_tasks_enabled(void);                           // Gorevler FreeRTOS gorevi olarak mi calisiyor
+int kernel_tasks_failed(void);                            // Gorev olusturulamadigi icin simulasyon yarida kaldi mi
+int kernel_tasks_set_pool(int slots);                     // --task-pool: statik yuva sayisi (0: heap)
+void kernel_tasks_run(int last_arrival);                  // Secimi FreeRTOS'a birakan zamanlama dongusu
+void kernel_tasks_print_report(void);                     // Olusturma/silme/oncelik/dagitim maliyetleri
+double kernel_tasks_print_run_time(double total_ns);       // Silinen gorevlerin seviye bazinda calisma suresi
+
+// Donanim performans sayaci fazlari (perfcount.c)
+typedef enum {
+    PERF_PHASE_LOAD,            // Gorevlerin yuklenmesi
+    PERF_PHASE_SIMULATE,        // Scheduler dongusu
+    PERF_PHASE_REPORT,          // Simulasyon sonu raporu
+    PERF_PHASE_COUNT
+} PerfPhase;
+
+int perf_counters_enable(void);                           // --perf-counters (sadece Linux)
+void perf_counters_begin(PerfPhase phase);                // Cagiran is parcacigi icin sayaclari ac
+void perf_counters_end(PerfPhase phase);                  // Sayaclari oku ve kapat
+void perf_counters_print(void);                           // Faz bazli sayac ozetini yazdir
+
+// Faz profili (profile.c): sadece PROFILE=1 derlemesinde etkin, aksi halde kod uretmez
+#ifdef SIM_PROFILE
+typedef enum {
+    PROFILE_LOAD,               // load_tasks_from_file
+    PROFILE_LOOP,               // Scheduler dongusunun fazlara ayrilmayan kismi
+    PROFILE_ARRIVALS,           // check_arriving_tasks
+    PROFILE_TIMEOUTS,           // check_timeouts
+    PROFILE_DISPATCH,           // Kuyruk secimi, alma/geri koyma ve preemption karari
+    PROFILE_OUTPUT,             // print_task_status
+    PROFILE_WAIT,               // Quantum bekleme (vTaskDelay)
+    PROFILE_CHECKPOINT,         // Durum kaydi ve kayit gunlugu
+    PROFILE_REPORT,             // Simulasyon sonu raporu
+    PROFILE_PHASE_COUNT
+} ProfilePhase;
+
+void profile_begin(ProfilePhase phase);
+void profile_end(ProfilePhase phase);
+void profile_print_report(void);
+
+#define PROFILE_BEGIN(phase)    profile_begin(phase)
+#define PROFILE_END(phase)      profile_end(phase)
+#define PROFILE_PRINT()         profile_print_report()
+#else
+#define PROFILE_BEGIN(phase)    ((void)0)
+#define PROFILE_END(phase)      ((void)0)
+#define PROFILE_PRINT()         ((void)0)
+#endif
+
 #endif /* SCHEDULER_H */
@@ -2,6 +2,8 @@
 
 #include "scheduler.h"
 
+extern const char* COLOR_PALETTE[];
+
 // Gorev yardimci fonksiyonlari
 const char* get_task_state_string(TaskState state) {
     switch (state) {
@@ -33,6 +35,38 @@ void print_task_info(TaskInfo* task) {
     printf("  Tip: %s\n", get_task_type_string(task->type));
 }
 
+void task_init(TaskInfo* task, int task_id, int arrival_time, int priority, int burst_time) {
+    if (task == NULL) return;
+
+    task->task_id = task_id;
+    // Gorev isimlendirme haritasi
+    static const int name_map[12] = { 1, 2, 9, 3, 4, 5, 11, 6, 7, 8, 12, 10 };
+    if (task_id < (int)(sizeof(name_map)/sizeof(name_map[0]))) {
+        snprintf(task->task_name, sizeof(task->task_name), "task%d", name_map[task_id]);
+    } else {
+        snprintf(task->task_name, sizeof(task->task_name), "task%d", task_id + 1);
+    }
+    // Gorev bilgilerini ayarla
+    task->arrival_time = arrival_time;
+    task->original_priority = priority;
+    task->current_priority = priority;  // Baslangicta original ile ayni
+    task->burst_time = burst_time;
+    task->remaining_time = burst_time;  // Baslangicta burst ile ayni
+    task->executed_time = 0;
+    task->state = TASK_STATE_WAITING;   // Henuz gelmedi
+    task->type = (priority == PRIORITY_REALTIME) ? TASK_TYPE_REALTIME : TASK_TYPE_USER;
+    task->start_time = -1;              // Henuz baslamadi
+    task->completion_time = -1;         // Henuz bitmedi
+    task->color_code = COLOR_PALETTE[task_id % COLOR_PALETTE_SIZE];  // Renkli cikti icin
+    task->timeout_printed = 0;
+    task->last_active_time = arrival_time;  // Son aktif zaman = varis zamani
+    task->waiting_time = 0;
+    task->response_time = -1;
+    task->turnaround_time = 0;
+    task->last_core = -1;               // Henuz hicbir cekirdekte calismadi
+    task->partial_work = 0;
+}
+
 void task_start(TaskInfo* task, int current_time) {
     if (task == NULL) return;
     
@@ -59,6 +93,7 @@ void task_terminate(TaskInfo* task, int current_time) {
     
     task->state = TASK_STATE_TERMINATED;
     task->completion_time = current_time;
+    metrics_record_task(task);  // Metrikleri sonlanma aninda biriktir
 }
 
 int task_execute(TaskInfo* task) {
@@ -0,0 +1,629 @@
+// Olay izi: ikili iz yazimi ve iki calismanin karsilastirilmasi
+//
+// --trace ile her durum satiri (basladi, askida, ...) 16 baytlik sabit boyutlu
+// bir kayit olarak da yazilir. --compare iki izi (metin cikti veya ikili iz)
+// akis halinde okur, olaylari simulasyon zamanina gore hizalar, ilk ayrismayi
+// ve gorev bazli metrik farklarini raporlar. Bellek, toplam olay sayisiyla
+// degil bir zaman adimindaki olay sayisi ve canli gorev sayisiyla orantilidir.
+
+#include "scheduler.h"
+
+#define TRACE_MAGIC             0x54535246u     // "FRST"
+#define TRACE_VERSION           1
+#define TRACE_RECORD_SIZE       16
+#define TRACE_IO_BUFFER_SIZE    (1 << 20)       // Akis okuma/yazma tamponu
+#define TRACE_LINE_MAX          512
+#define COMPARE_TASK_LIMIT      20              // Ayrintili listelenen gorev farki sayisi
+
+// Olay tipleri (ikili izde tek bayt)
+typedef enum {
+    TRACE_EVENT_STARTED,        // basladi
+    TRACE_EVENT_RUNNING,        // yurutuluyor
+    TRACE_EVENT_SUSPENDED,      // askida
+    TRACE_EVENT_FINISHED,       // sonlandi
+    TRACE_EVENT_TIMEOUT,        // zamanasimi
+    TRACE_EVENT_COUNT
+} TraceEventType;
+
+static const char* TRACE_EVENT_NAMES[TRACE_EVENT_COUNT] = {
+    "basladi", "yurutuluyor", "askida", "sonlandi", "zamanasimi"
+};
+
+// Tek olay: bir durum satirinin icerigi
+typedef struct {
+    int time;
+    int task_id;
+    int type;
+    int priority;
+    int remaining;
+} TraceEvent;
+
+// Iz okuyucu: metin veya ikili
+typedef struct {
+    const char* path;
+    FILE* file;
+    char* io_buffer;
+    int binary;
+    long long event_count;
+    TraceEvent pending;         // Bir sonraki zaman adiminin ilk olayi
+    int has_pending;
+} TraceReader;
+
+// Bir zaman adimindaki olaylar
+typedef struct {
+    TraceEvent* events;
+    int count;
+    int capacity;
+} TraceBatch;
+
+// Gorev bazli ozet (her iz icin ayri)
+typedef struct {
+    int start_time;             // Ilk "basladi" zamani (-1: yok)
+    int end_time;               // sonlandi/zamanasimi zamani (-1: yok)
+    int run_count;              // Calistirilan quantum sayisi
+    int outcome;                // Son olay tipi (-1: yok)
+} TaskSummary;
+
+// Canli gorev tablosu girdisi: iki izde de bitene kadar tutulur
+typedef struct {
+    int task_id;                // -1: bos
+    TaskSummary side[2];
+} CompareEntry;
+
+typedef struct {
+    CompareEntry* entries;
+    int capacity;               // 2'nin kuvveti
+    int count;
+} CompareTable;
+
+// Gorev farklari ozeti
+typedef struct {
+    long long differing_tasks;
+    long long outcome_changes;
+    long long total_response_delta;
+    long long total_turnaround_delta;
+    long long response_tasks;       // Iki tarafta da baslayan (yanit farki tanimli)
+    long long turnaround_tasks;     // Iki tarafta da biten (donus farki tanimli)
+    long long one_sided_starts;     // Sadece bir tarafta baslayan
+    int max_turnaround_delta;
+    int listed;
+} CompareTotals;
+
+// Extern degiskenler (main.c'de tanimlandi)
+extern int g_current_time;
+
+// Iz yazici durumu
+static FILE* s_trace_file = NULL;
+static char* s_trace_buffer = NULL;
+
+static void trace_put_u32(unsigned char* out, uint32_t value) {
+    out[0] = (unsigned char)value;
+    out[1] = (unsigned char)(value >> 8);
+    out[2] = (unsigned char)(value >> 16);
+    out[3] = (unsigned char)(value >> 24);
+}
+
+static uint32_t trace_get_u32(const unsigned char* in) {
+    return (uint32_t)in[0] | ((uint32_t)in[1] << 8) |
+           ((uint32_t)in[2] << 16) | ((uint32_t)in[3] << 24);
+}
+
+static int trace_event_type(const char* status) {
+    for (int i = 0; i < TRACE_EVENT_COUNT; i++) {
+        if (strcmp(status, TRACE_EVENT_NAMES[i]) == 0) return i;
+    }
+    return -1;
+}
+
+int trace_open(const char* path) {
+    if (path == NULL) return 0;
+
+    s_trace_file = fopen(path, "wb");
+    if (s_trace_file == NULL) return -1;
+    s_trace_buffer = malloc(TRACE_IO_BUFFER_SIZE);
+    if (s_trace_buffer != NULL) {
+        setvbuf(s_trace_file, s_trace_buffer, _IOFBF, TRACE_IO_BUFFER_SIZE);
+    }
+
+    unsigned char header[8];
+    trace_put_u32(header, TRACE_MAGIC);
+    trace_put_u32(header + 4, TRACE_VERSION);
+    if (fwrite(header, 1, sizeof(header), s_trace_file) != sizeof(header)) {
+        trace_close();
+        return -1;
+    }
+    return 0;
+}
+
+void trace_record(const TaskInfo* task, const char* status) {
+    if (s_trace_file == NULL) return;
+
+    int type = trace_event_type(status);
+    if (type < 0) return;
+
+    // Kayit: zaman(4) id(4) tip(1) oncelik(1) bos(2) kalan sure(4)
+    unsigned char record[TRACE_RECORD_SIZE];
+    trace_put_u32(record, (uint32_t)g_current_time);
+    trace_put_u32(record + 4, (uint32_t)task->task_id);
+    record[8] = (unsigned char)type;
+    record[9] = (unsigned char)task->current_priority;
+    record[10] = 0;
+    record[11] = 0;
+    trace_put_u32(record + 12, (uint32_t)task->remaining_time);
+    if (fwrite(record, 1, sizeof(record), s_trace_file) != sizeof(record)) {
+        fprintf(stderr, "[HATA] Olay izi yazilamadi, iz durduruldu\n");
+        trace_close();
+    }
+}
+
+void trace_close(void) {
+    if (s_trace_file == NULL) return;
+    if (fclose(s_trace_file) != 0) {
+        fprintf(stderr, "[HATA] Olay izi kapatilamadi\n");
+    }
+    s_trace_file = NULL;
+    free(s_trace_buffer);
+    s_trace_buffer = NULL;
+}
+
+// ---------------------------------------------------------------------------
+// Iz okuma
+// ---------------------------------------------------------------------------
+
+static int trace_reader_open(TraceReader* rd, const char* path) {
+    memset(rd, 0, sizeof(*rd));
+    rd->path = path;
+    rd->file = fopen(path, "rb");
+    if (rd->file == NULL) return -1;
+    rd->io_buffer = malloc(TRACE_IO_BUFFER_SIZE);
+    if (rd->io_buffer != NULL) {
+        setvbuf(rd->file, rd->io_buffer, _IOFBF, TRACE_IO_BUFFER_SIZE);
+    }
+
+    // Bicim tespiti: ikili iz sihirli sayiyla baslar
+    unsigned char header[8];
+    size_t n = fread(header, 1, sizeof(header), rd->file);
+    if (n == sizeof(header) && trace_get_u32(header) == TRACE_MAGIC) {
+        if (trace_get_u32(header + 4) != TRACE_VERSION) return -1;
+        rd->binary = 1;
+    } else {
+        rewind(rd->file);
+    }
+    return 0;
+}
+
+static void trace_reader_close(TraceReader* rd) {
+    if (rd->file != NULL) fclose(rd->file);
+    free(rd->io_buffer);
+    rd->file = NULL;
+    rd->io_buffer = NULL;
+}
+
+// Renk kodlarini (ESC [ ... m) yerinde sil
+static void trace_strip_ansi(char* line) {
+    char* out = line;
+    for (char* in = line; *in != '\0'; in++) {
+        if (*in == '\033' && in[1] == '[') {
+            in += 2;
+            while (*in != '\0' && *in != 'm') in++;
+            if (*in == '\0') break;
+            continue;
+        }
+        *out++ = *in;
+    }
+    *out = '\0';
+}
+
+// Metin satirini olaya cevir; durum satiri degilse 0 doner
+static int trace_parse_line(char* line, TraceEvent* ev) {
+    trace_strip_ansi(line);
+
+    char* p = line;
+    char* end;
+    double time = strtod(p, &end);
+    if (end == p || strncmp(end, " sn ", 4) != 0) return 0;
+    p = end + 4;
+
+    // Gorev adi ve durum kelimesi
+    while (*p == ' ') p++;
+    while (*p != ' ' && *p != '\0') p++;
+    while (*p == ' ') p++;
+    char* status = p;
+    while (*p != ' ' && *p != '\0') p++;
+    if (*p == '\0') return 0;
+    *p++ = '\0';
+
+    int type = trace_event_type(status);
+    if (type < 0) return 0;
+
+    int id, priority, remaining;
+    if (sscanf(p, " (id:%d oncelik:%d kalan sure:%d sn)", &id, &priority, &remaining) != 3) {
+        return 0;
+    }
+
+    ev->time = (int)(time + 0.5);
+    ev->task_id = id;
+    ev->type = type;
+    ev->priority = priority;
+    ev->remaining = remaining;
+    return 1;
+}
+
+// Sonraki olay: 1 okundu, 0 iz bitti, -1 hata
+static int trace_read_event(TraceReader* rd, TraceEvent* ev) {
+    if (rd->binary) {
+        unsigned char record[TRACE_RECORD_SIZE];
+        size_t n = fread(record, 1, sizeof(record), rd->file);
+        if (n == 0 && feof(rd->file)) return 0;
+        if (n != sizeof(record) || record[8] >= TRACE_EVENT_COUNT) return -1;
+        ev->time = (int)trace_get_u32(record);
+        ev->task_id = (int)trace_get_u32(record + 4);
+        ev->type = record[8];
+        ev->priority = record[9];
+        ev->remaining = (int)trace_get_u32(record + 12);
+        return 1;
+    }
+
+    // Metin iz: durum satiri olmayanlar (rapor, hata mesajlari) atlanir
+    char line[TRACE_LINE_MAX];
+    while (fgets(line, sizeof(line), rd->file) != NULL) {
+        if (trace_parse_line(line, ev)) return 1;
+    }
+    return ferror(rd->file) ? -1 : 0;
+}
+
+static int batch_push(TraceBatch* batch, const TraceEvent* ev) {
+    if (batch->count == batch->capacity) {
+        int new_capacity = batch->capacity > 0 ? batch->capacity * 2 : 64;
+        TraceEvent* grown = realloc(batch->events, (size_t)new_capacity * sizeof(TraceEvent));
+        if (grown == NULL) return -1;
+        batch->events = grown;
+        batch->capacity = new_capacity;
+    }
+    batch->events[batch->count++] = *ev;
+    return 0;
+}
+
+// Bir sonraki zaman adiminin tum olaylarini oku: 1 okundu, 0 iz bitti, -1 hata
+static int trace_read_batch(TraceReader* rd, TraceBatch* batch) {
+    batch->count = 0;
+    if (!rd->has_pending) {
+        int r = trace_read_event(rd, &rd->pending);
+        if (r <= 0) return r;
+        rd->has_pending = 1;
+    }
+
+    int time = rd->pending.time;
+    while (rd->has_pending && rd->pending.time == time) {
+        if (batch_push(batch, &rd->pending) != 0) return -1;
+        rd->event_count++;
+        int r = trace_read_event(rd, &rd->pending);
+        if (r < 0) return -1;
+        rd->has_pending = (r == 1);
+    }
+    return 1;
+}
+
+// ---------------------------------------------------------------------------
+// Canli gorev tablosu (acik adresleme, geri kaydirmali silme)
+// ---------------------------------------------------------------------------
+
+static unsigned int compare_hash(int task_id, int capacity) {
+    return ((unsigned int)task_id * 2654435761u) & (unsigned int)(capacity - 1);
+}
+
+static int compare_table_grow(CompareTable* table) {
+    int new_capacity = table->capacity > 0 ? table->capacity * 2 : 256;
+    CompareEntry* entries = malloc((size_t)new_capacity * sizeof(CompareEntry));
+    if (entries == NULL) return -1;
+    for (int i = 0; i < new_capacity; i++) entries[i].task_id = -1;
+
+    for (int i = 0; i < table->capacity; i++) {
+        if (table->entries[i].task_id < 0) continue;
+        unsigned int slot = compare_hash(table->entries[i].task_id, new_capacity);
+        while (entries[slot].task_id >= 0) slot = (slot + 1) & (unsigned int)(new_capacity - 1);
+        entries[slot] = table->entries[i];
+    }
+    free(table->entries);
+    table->entries = entries;
+    table->capacity = new_capacity;
+    return 0;
+}
+
+static CompareEntry* compare_table_get(CompareTable* table, int task_id) {
+    if ((table->count + 1) * 2 > table->capacity && compare_table_grow(table) != 0) {
+        return NULL;
+    }
+
+    unsigned int mask = (unsigned int)(table->capacity - 1);
+    unsigned int slot = compare_hash(task_id, table->capacity);
+    while (table->entries[slot].task_id >= 0) {
+        if (table->entries[slot].task_id == task_id) return &table->entries[slot];
+        slot = (slot + 1) & mask;
+    }
+
+    CompareEntry* entry = &table->entries[slot];
+    entry->task_id = task_id;
+    for (int s = 0; s < 2; s++) {
+        entry->side[s].start_time = -1;
+        entry->side[s].end_time = -1;
+        entry->side[s].run_count = 0;
+        entry->side[s].outcome = -1;
+    }
+    table->count++;
+    return entry;
+}
+
+static void compare_table_remove(CompareTable* table, CompareEntry* entry) {
+    unsigned int mask = (unsigned int)(table->capacity - 1);
+    unsigned int hole = (unsigned int)(entry - table->entries);
+    unsigned int slot = hole;
+    table->entries[hole].task_id = -1;
+    table->count--;
+
+    // Zincirdeki sonraki girdileri bosluga kaydir
+    for (;;) {
+        slot = (slot + 1) & mask;
+        if (table->entries[slot].task_id < 0) return;
+        unsigned int home = compare_hash(table->entries[slot].task_id, table->capacity);
+        if (((slot - home) & mask) >= ((slot - hole) & mask)) {
+            table->entries[hole] = table->entries[slot];
+            table->entries[slot].task_id = -1;
+            hole = slot;
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Karsilastirma
+// ---------------------------------------------------------------------------
+
+static void compare_format_event(const TraceEvent* ev, char* out, size_t out_size) {
+    if (ev == NULL) {
+        snprintf(out, out_size, "(olay yok)");
+        return;
+    }
+    snprintf(out, out_size, "%7.4f sn id:%04d %-12s oncelik:%d kalan sure:%2d sn",
+             (float)ev->time, ev->task_id, TRACE_EVENT_NAMES[ev->type],
+             ev->priority, ev->remaining);
+}
+
+static int events_equal(const TraceEvent* a, const TraceEvent* b) {
+    return a->time == b->time && a->task_id == b->task_id && a->type == b->type &&
+           a->priority == b->priority && a->remaining == b->remaining;
+}
+
+static const char* compare_outcome_name(int outcome) {
+    return outcome < 0 ? "-" : TRACE_EVENT_NAMES[outcome];
+}
+
+static void compare_summary_time(char* out, size_t out_size, int value) {
+    if (value < 0) snprintf(out, out_size, "-");
+    else snprintf(out, out_size, "%d", value);
+}
+
+// Fark sadece iki zaman da varsa tanimlidir
+static void compare_summary_delta(char* out, size_t out_size, int a, int b) {
+    if (a < 0 || b < 0) snprintf(out, out_size, "-");
+    else snprintf(out, out_size, "%+d", b - a);
+}
+
+// Iki tarafta da biten gorevin farkini isle
+static void compare_finish_task(const CompareEntry* entry, CompareTotals* totals) {
+    const TaskSummary* a = &entry->side[0];
+    const TaskSummary* b = &entry->side[1];
+
+    int differs = a->start_time != b->start_time || a->end_time != b->end_time ||
+                  a->run_count != b->run_count || a->outcome != b->outcome;
+    if (!differs) return;
+
+    totals->differing_tasks++;
+    if (a->outcome != b->outcome) totals->outcome_changes++;
+
+    // Varis iki calismada aynidir: baslama/bitis farki yanit/donus farkina esittir.
+    // Bir tarafta hic baslamayan gorevin yanit farki yoktur, ayrica sayilir.
+    if (a->start_time >= 0 && b->start_time >= 0) {
+        totals->total_response_delta += b->start_time - a->start_time;
+        totals->response_tasks++;
+    } else if (a->start_time >= 0 || b->start_time >= 0) {
+        totals->one_sided_starts++;
+    }
+    if (a->end_time >= 0 && b->end_time >= 0) {
+        int turnaround_delta = b->end_time - a->end_time;
+        totals->total_turnaround_delta += turnaround_delta;
+        totals->turnaround_tasks++;
+        if (abs(turnaround_delta) > abs(totals->max_turnaround_delta)) {
+            totals->max_turnaround_delta = turnaround_delta;
+        }
+    }
+
+    if (totals->listed == 0) {
+        printf("\nGorev farklari (ilk %d):\n", COMPARE_TASK_LIMIT);
+        printf("%-6s %7s %7s %7s %7s %11s %11s %7s %7s\n",
+               "id", "bas.a", "bas.b", "bitis.a", "bitis.b",
+               "durum.a", "durum.b", "d.yanit", "d.donus");
+    }
+    if (totals->listed < COMPARE_TASK_LIMIT) {
+        char sa[16], sb[16], ea[16], eb[16], dr[16], dt[16];
+        compare_summary_time(sa, sizeof(sa), a->start_time);
+        compare_summary_time(sb, sizeof(sb), b->start_time);
+        compare_summary_time(ea, sizeof(ea), a->end_time);
+        compare_summary_time(eb, sizeof(eb), b->end_time);
+        compare_summary_delta(dr, sizeof(dr), a->start_time, b->start_time);
+        compare_summary_delta(dt, sizeof(dt), a->end_time, b->end_time);
+        char id[16];
+        snprintf(id, sizeof(id), "%04d", entry->task_id);
+        printf("%-6s %7s %7s %7s %7s %11s %11s %7s %7s\n",
+               id, sa, sb, ea, eb,
+               compare_outcome_name(a->outcome), compare_outcome_name(b->outcome),
+               dr, dt);
+    }
+    totals->listed++;
+}
+
+// Olayi tarafin gorev ozetine isle; iki tarafta da bittiyse tablodan cikar
+static int compare_apply_event(CompareTable* table, const TraceEvent* ev, int side,
+                               CompareTotals* totals) {
+    CompareEntry* entry = compare_table_get(table, ev->task_id);
+    if (entry == NULL) return -1;
+
+    TaskSummary* summary = &entry->side[side];
+    switch (ev->type) {
+        case TRACE_EVENT_STARTED:
+            if (summary->start_time < 0) summary->start_time = ev->time;
+            break;
+        case TRACE_EVENT_SUSPENDED:
+        case TRACE_EVENT_RUNNING:
+            summary->run_count++;   // Onceki quantum tamamlandi
+            break;
+        case TRACE_EVENT_FINISHED:
+            summary->run_count++;
+            summary->end_time = ev->time;
+            break;
+        case TRACE_EVENT_TIMEOUT:
+            summary->end_time = ev->time;
+            break;
+        default:
+            break;
+    }
+    summary->outcome = ev->type;
+
+    if (entry->side[0].end_time >= 0 && entry->side[1].end_time >= 0) {
+        compare_finish_task(entry, totals);
+        compare_table_remove(table, entry);
+    }
+    return 0;
+}
+
+int compare_traces(const char* path_a, const char* path_b) {
+    TraceReader readers[2];
+    if (trace_reader_open(&readers[0], path_a) != 0) {
+        printf("[HATA] Iz acilamadi veya gecersiz: %s\n", path_a);
+        trace_reader_close(&readers[0]);
+        return -1;
+    }
+    if (trace_reader_open(&readers[1], path_b) != 0) {
+        printf("[HATA] Iz acilamadi veya gecersiz: %s\n", path_b);
+        trace_reader_close(&readers[0]);
+        trace_reader_close(&readers[1]);
+        return -1;
+    }
+
+    printf("Karsilastirma: %s (%s) <-> %s (%s)\n",
+           path_a, readers[0].binary ? "ikili" : "metin",
+           path_b, readers[1].binary ? "ikili" : "metin");
+
+    TraceBatch batches[2] = { { NULL, 0, 0 }, { NULL, 0, 0 } };
+    CompareTable table = { NULL, 0, 0 };
+    CompareTotals totals;
+    memset(&totals, 0, sizeof(totals));
+
+    long long differing_steps = 0;
+    long long event_index = 0;      // Ilk ayrismaya kadar ayni olan olay sayisi
+    int diverged = 0;
+    int result = 0;
+    int has[2] = { 0, 0 };
+
+    for (int s = 0; s < 2; s++) {
+        has[s] = trace_read_batch(&readers[s], &batches[s]);
+        if (has[s] < 0) result = -1;
+    }
+
+    // Zaman adimlarini hizala: her turda en kucuk zamanli adim(lar) islenir
+    while (result == 0 && (has[0] > 0 || has[1] > 0)) {
+        int time_a = has[0] > 0 ? batches[0].events[0].time : -1;
+        int time_b = has[1] > 0 ? batches[1].events[0].time : -1;
+        int use[2];
+        use[0] = has[0] > 0 && (has[1] <= 0 || time_a <= time_b);
+        use[1] = has[1] > 0 && (has[0] <= 0 || time_b <= time_a);
+
+        int count_a = use[0] ? batches[0].count : 0;
+        int count_b = use[1] ? batches[1].count : 0;
+        int same = (count_a == count_b);
+        int first_diff = 0;
+        while (first_diff < count_a && first_diff < count_b &&
+               events_equal(&batches[0].events[first_diff], &batches[1].events[first_diff])) {
+            first_diff++;
+        }
+        if (first_diff < count_a || first_diff < count_b) same = 0;
+
+        if (!same) {
+            differing_steps++;
+            if (!diverged) {
+                diverged = 1;
+                char line_a[128], line_b[128];
+                compare_format_event(first_diff < count_a ? &batches[0].events[first_diff] : NULL,
+                                     line_a, sizeof(line_a));
+                compare_format_event(first_diff < count_b ? &batches[1].events[first_diff] : NULL,
+                                     line_b, sizeof(line_b));
+                printf("Ilk ayrisma: t=%d, olay #%lld\n", use[0] ? time_a : time_b,
+                       event_index + first_diff + 1);
+                printf("  a: %s\n", line_a);
+                printf("  b: %s\n", line_b);
+            }
+        } else if (!diverged) {
+            event_index += count_a;
+        }
+
+        for (int s = 0; s < 2 && result == 0; s++) {
+            if (!use[s]) continue;
+            for (int i = 0; i < batches[s].count; i++) {
+                if (compare_apply_event(&table, &batches[s].events[i], s, &totals) != 0) {
+                    printf("[HATA] Karsilastirma icin bellek yetersiz\n");
+                    result = -1;
+                    break;
+                }
+            }
+            has[s] = trace_read_batch(&readers[s], &batches[s]);
+            if (has[s] < 0) result = -1;
+        }
+    }
+
+    for (int s = 0; s < 2; s++) {
+        if (has[s] < 0) {
+            printf("[HATA] Iz okunamadi veya bozuk: %s\n", readers[s].path);
+        }
+    }
+
+    if (result == 0) {
+        if (!diverged) printf("Ayrisma yok: izler ayni\n");
+
+        // Bir tarafta bitmeyen gorevler: kalan farklar
+        long long unfinished = table.count;
+        for (int i = 0; i < table.capacity; i++) {
+            CompareEntry* entry = &table.entries[i];
+            if (entry->task_id < 0) continue;
+            if (memcmp(&entry->side[0], &entry->side[1], sizeof(TaskSummary)) != 0) {
+                compare_finish_task(entry, &totals);
+            }
+        }
+
+        printf("\nOlay sayisi            : a=%lld b=%lld\n",
+               readers[0].event_count, readers[1].event_count);
+        printf("Farkli zaman adimi     : %lld\n", differing_steps);
+        printf("Farkli gorev           : %lld (durumu degisen: %lld, bitmeyen: %lld)\n",
+               totals.differing_tasks, totals.outcome_changes, unfinished);
+        if (totals.response_tasks > 0) {
+            printf("Ort. yanit farki       : %+.2f sn (iki tarafta baslayan %lld gorev)\n",
+                   (double)totals.total_response_delta / totals.response_tasks,
+                   totals.response_tasks);
+        }
+        if (totals.one_sided_starts > 0) {
+            printf("Tek tarafta baslayan   : %lld\n", totals.one_sided_starts);
+        }
+        if (totals.turnaround_tasks > 0) {
+            printf("Ort. donus farki       : %+.2f sn (iki tarafta biten %lld gorev)\n",
+                   (double)totals.total_turnaround_delta / totals.turnaround_tasks,
+                   totals.turnaround_tasks);
+            printf("En buyuk donus farki   : %+d sn\n", totals.max_turnaround_delta);
+        }
+        result = diverged ? 1 : 0;
+    }
+
+    free(batches[0].events);
+    free(batches[1].events);
+    free(table.entries);
+    trace_reader_close(&readers[0]);
+    trace_reader_close(&readers[1]);
+    return result;
+}
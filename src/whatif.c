@@ -0,0 +1,455 @@
+// Ne-olursa (what-if) analizi: hafif durum kayitlarindan kismi yeniden simulasyon
+//
+// Temel calisma --snapshots ile periyodik kayit gunlugu yazar. Gunlugun basinda is
+// yukunun tanimi (varis, oncelik, sure) bulunur; her kayit ise sadece onceki kayittan
+// bu yana degisebilecek gorevleri (onceki kayitta canli olanlar + aradaki varislar),
+// kuyruklari ve metrik biriktiricilerini icerir. Bu sayede kayitlar gorev sayisiyla
+// degil, canli gorev sayisiyla orantili kalir.
+//
+// --whatif ile duzenlenmis is yuku verildiginde degisikliklerin henuz hicbir seyi
+// etkilemedigi en son kayit bulunur, duzenlemeler o duruma uygulanir ve simulasyon
+// t=0 yerine oradan devam eder.
+
+#include "scheduler.h"
+
+#define SNAPLOG_MAGIC           0x4C535246u     // "FRSL"
+#define SNAPLOG_VERSION         1
+
+// Extern degiskenler (main.c ve metrics.c'de tanimlandi)
+extern TaskInfo* g_tasks;
+extern int g_task_count;
+extern int g_completed_tasks;
+extern int g_current_time;
+extern int g_context_switches;
+extern DynamicQueue g_priority_queues[MAX_PRIORITY_LEVEL];
+
+// Duzenleme tipleri: her biri farkli bir "henuz etkilemedi" kosuluna sahiptir
+typedef enum {
+    EDIT_NONE,
+    EDIT_ARRIVAL,       // Varis/oncelik degisti veya gorev eklendi/silindi: gorev henuz gelmemis olmali
+    EDIT_BURST          // Sadece sure degisti: gorev henuz hic calismamis olmali
+} EditKind;
+
+// Gorev tanimi (is yuku dosyasindaki bir satir)
+typedef struct {
+    int arrival_time;
+    int priority;
+    int burst_time;
+} TaskDefinition;
+
+// Kayit gunlugu yazici durumu
+static FILE* s_log_file = NULL;
+static SnapshotBuffer s_log_buffer;
+static int s_log_interval = CHECKPOINT_DEFAULT_INTERVAL;
+static int s_log_next_time = 0;
+static int* s_prev_live = NULL;         // Onceki kayitta canli olan gorev indeksleri
+static int s_prev_live_count = 0;
+static int s_prev_live_capacity = 0;
+static int s_prev_arrived = 0;          // Onceki kayitta islenmis varis sayisi
+
+// Cerceveli kayit yaz: uzunluk + icerik
+static int snaplog_write_frame(const SnapshotBuffer* buf) {
+    SnapshotBuffer len_buf = { NULL, 0, 0, 0 };
+    snapshot_put_uvarint(&len_buf, buf->len);
+    int ok = !len_buf.error &&
+             fwrite(len_buf.data, 1, len_buf.len, s_log_file) == len_buf.len &&
+             fwrite(buf->data, 1, buf->len, s_log_file) == buf->len;
+    free(len_buf.data);
+    return ok ? 0 : -1;
+}
+
+// Cerceveli kayit oku; dosya sonunda 1, hatada -1 doner
+static int snaplog_read_frame(FILE* file, SnapshotBuffer* buf) {
+    uint64_t len = 0;
+    int shift = 0;
+    int c;
+    while ((c = fgetc(file)) != EOF) {
+        len |= (uint64_t)(c & 0x7F) << shift;
+        if ((c & 0x80) == 0) break;
+        shift += 7;
+        if (shift >= 64) return -1;
+    }
+    if (c == EOF) return shift == 0 ? 1 : -1;
+
+    buf->len = 0;
+    buf->error = 0;
+    if (snapshot_reserve(buf, (size_t)len) != 0) return -1;
+    if (fread(buf->data, 1, (size_t)len, file) != (size_t)len) return -1;
+    buf->len = (size_t)len;
+    return 0;
+}
+
+static int snaplog_remember_live(const DynamicQueue* q) {
+    for (int i = 0; i < q->count; i++) {
+        if (q->tasks[i]->state == TASK_STATE_TERMINATED) continue;  // Artik degismez
+        if (s_prev_live_count >= s_prev_live_capacity) {
+            int capacity = s_prev_live_capacity ? s_prev_live_capacity * 2 : INITIAL_QUEUE_CAPACITY;
+            int* live = realloc(s_prev_live, (size_t)capacity * sizeof(int));
+            if (live == NULL) return -1;
+            s_prev_live = live;
+            s_prev_live_capacity = capacity;
+        }
+        s_prev_live[s_prev_live_count++] = (int)(q->tasks[i] - g_tasks);
+    }
+    return 0;
+}
+
+int snapshot_log_open(const char* path, int interval) {
+    if (path == NULL) return 0;
+
+    s_log_file = fopen(path, "wb");
+    if (s_log_file == NULL) return -1;
+    s_log_interval = interval > 0 ? interval : CHECKPOINT_DEFAULT_INTERVAL;
+    s_log_next_time = g_current_time + s_log_interval;
+    s_prev_live_count = 0;
+    s_prev_arrived = 0;
+
+    // Baslik: sabitler ve temel is yukunun tanimi
+    SnapshotBuffer* buf = &s_log_buffer;
+    buf->len = 0;
+    buf->error = 0;
+    snapshot_put_uvarint(buf, SNAPLOG_MAGIC);
+    snapshot_put_uvarint(buf, SNAPLOG_VERSION);
+    snapshot_put_uvarint(buf, MAX_PRIORITY_LEVEL);
+    snapshot_put_uvarint(buf, HIST_COUNTS_LEN);
+    snapshot_put_varint(buf, g_task_count);
+    for (int i = 0; i < g_task_count; i++) {
+        snapshot_put_varint(buf, g_tasks[i].arrival_time);
+        snapshot_put_varint(buf, g_tasks[i].original_priority);
+        snapshot_put_varint(buf, g_tasks[i].burst_time);
+    }
+
+    if (buf->error || snaplog_write_frame(buf) != 0) {
+        fclose(s_log_file);
+        s_log_file = NULL;
+        return -1;
+    }
+    return 0;
+}
+
+void snapshot_log_maybe_record(void) {
+    if (s_log_file == NULL || g_current_time < s_log_next_time) return;
+
+    SnapshotBuffer* buf = &s_log_buffer;
+    buf->len = 0;
+    buf->error = 0;
+
+    snapshot_put_varint(buf, g_current_time);
+    snapshot_put_varint(buf, g_completed_tasks);
+    snapshot_put_varint(buf, g_context_switches);
+
+    // Degisen gorevler: onceki kayitta canli olanlar + o zamandan beri gelenler
+    int arrived = scheduler_arrived_count();
+    snapshot_put_varint(buf, s_prev_live_count + (arrived - s_prev_arrived));
+    for (int i = 0; i < s_prev_live_count; i++) {
+        snapshot_put_varint(buf, s_prev_live[i]);
+        snapshot_put_task(buf, &g_tasks[s_prev_live[i]]);
+    }
+    for (int pos = s_prev_arrived; pos < arrived; pos++) {
+        TaskInfo* task = scheduler_arrival_at(pos);
+        snapshot_put_varint(buf, task - g_tasks);
+        snapshot_put_task(buf, task);
+    }
+
+    snapshot_put_queues(buf);
+    snapshot_put_metrics(buf);
+
+    if (buf->error || snaplog_write_frame(buf) != 0) {
+        fprintf(stderr, "[HATA] Kayit gunlugu yazilamadi, kayit durduruldu\n");
+        fclose(s_log_file);
+        s_log_file = NULL;
+        return;
+    }
+
+    // Bir sonraki kaydin degisim kumesi icin canli gorevleri hatirla
+    s_prev_live_count = 0;
+    for (int p = 0; p < MAX_PRIORITY_LEVEL; p++) {
+        snaplog_remember_live(&g_priority_queues[p]);
+    }
+    snaplog_remember_live(scheduler_unqueued_tasks());
+    s_prev_arrived = arrived;
+    s_log_next_time = g_current_time + s_log_interval;
+}
+
+void snapshot_log_close(void) {
+    if (s_log_file == NULL) return;
+    if (fclose(s_log_file) != 0) {
+        fprintf(stderr, "[HATA] Kayit gunlugu kapatilamadi\n");
+    }
+    s_log_file = NULL;
+
+    free(s_log_buffer.data);
+    memset(&s_log_buffer, 0, sizeof(s_log_buffer));
+    free(s_prev_live);
+    s_prev_live = NULL;
+    s_prev_live_count = s_prev_live_capacity = 0;
+}
+
+static int min_int(int a, int b) {
+    return a < b ? a : b;
+}
+
+// Temel ve duzenlenmis tanimlari karsilastirip her gorev icin duzenleme tipini belirle.
+// limit_time: EDIT_ARRIVAL icin kaydin zamani bu degerden kucuk olmali.
+static int whatif_classify(const TaskDefinition* base, int base_count,
+                           const TaskDefinition* edited, int edited_count,
+                           unsigned char* kinds, int* limit_time) {
+    int edits = 0;
+    int count = base_count > edited_count ? base_count : edited_count;
+    *limit_time = INT32_MAX;
+
+    for (int i = 0; i < count; i++) {
+        kinds[i] = EDIT_NONE;
+        if (i >= base_count) {                  // Eklenen gorev
+            kinds[i] = EDIT_ARRIVAL;
+            *limit_time = min_int(*limit_time, edited[i].arrival_time);
+        } else if (i >= edited_count) {         // Silinen gorev
+            kinds[i] = EDIT_ARRIVAL;
+            *limit_time = min_int(*limit_time, base[i].arrival_time);
+        } else if (base[i].arrival_time != edited[i].arrival_time ||
+                   base[i].priority != edited[i].priority) {
+            kinds[i] = EDIT_ARRIVAL;
+            *limit_time = min_int(*limit_time, min_int(base[i].arrival_time, edited[i].arrival_time));
+        } else if (base[i].burst_time != edited[i].burst_time) {
+            kinds[i] = EDIT_BURST;
+        }
+        if (kinds[i] != EDIT_NONE) edits++;
+    }
+    return edits;
+}
+
+// Analiz sirasinda kullanilan gecici tamponlar
+typedef struct {
+    SnapshotBuffer frame;       // Okunan kayit cercevesi
+    TaskDefinition* base;       // Temel is yuku (gunluk basligindan)
+    TaskDefinition* edited;     // Duzenlenmis is yuku (giris dosyasindan)
+    unsigned char* kinds;       // Gorev basina EditKind
+    TaskInfo* delta;            // Kayittaki degisen gorevler
+    int* delta_index;
+    int delta_capacity;
+    int base_count;
+    int edited_count;
+    int limit_time;             // Varis tipli duzenlemeler icin kayit zamani siniri
+    int first_effect;           // Duzenlemenin ilk etkiledigi an
+} WhatIfContext;
+
+static void whatif_free(WhatIfContext* ctx) {
+    free(ctx->frame.data);
+    free(ctx->base);
+    free(ctx->edited);
+    free(ctx->kinds);
+    free(ctx->delta);
+    free(ctx->delta_index);
+}
+
+// Gunluk basligini oku ve temel is yukunu al
+static int whatif_read_header(FILE* file, WhatIfContext* ctx) {
+    if (snaplog_read_frame(file, &ctx->frame) != 0) return -1;
+
+    SnapshotReader rd = { ctx->frame.data, ctx->frame.len, 0, 0 };
+    if (snapshot_get_uvarint(&rd) != SNAPLOG_MAGIC ||
+        snapshot_get_uvarint(&rd) != SNAPLOG_VERSION ||
+        snapshot_get_uvarint(&rd) != MAX_PRIORITY_LEVEL ||
+        snapshot_get_uvarint(&rd) != HIST_COUNTS_LEN) {
+        return -1;
+    }
+
+    ctx->base_count = snapshot_get_int(&rd, 0, INT32_MAX);
+    if (rd.error) return -1;
+    ctx->base = malloc((size_t)(ctx->base_count > 0 ? ctx->base_count : 1) * sizeof(TaskDefinition));
+    if (ctx->base == NULL) return -1;
+
+    for (int i = 0; i < ctx->base_count; i++) {
+        ctx->base[i].arrival_time = snapshot_get_int(&rd, 0, INT32_MAX);
+        ctx->base[i].priority = snapshot_get_int(&rd, 0, INT32_MAX);
+        ctx->base[i].burst_time = snapshot_get_int(&rd, 1, INT32_MAX);
+    }
+    return rd.error ? -1 : 0;
+}
+
+// Bir kaydi oku; duzenlemeler henuz hicbir seyi etkilemediyse durumu uygula.
+// Donus: 1 uygulandi, 0 kayit artik gecerli degil, -1 bozuk veri.
+static int whatif_apply_record(WhatIfContext* ctx) {
+    SnapshotReader rec = { ctx->frame.data, ctx->frame.len, 0, 0 };
+    int snap_time = snapshot_get_int(&rec, 0, INT32_MAX);
+    int completed = snapshot_get_int(&rec, 0, ctx->base_count);
+    int switches = snapshot_get_int(&rec, 0, INT32_MAX);
+    int delta_count = snapshot_get_int(&rec, 0, ctx->base_count);
+    if (rec.error) return -1;
+
+    // Varis tipli duzenlemeler: kayit, etkilenen ilk varistan once alinmis olmali
+    int valid = snap_time < ctx->limit_time;
+
+    if (delta_count > ctx->delta_capacity) {
+        TaskInfo* delta = realloc(ctx->delta, (size_t)delta_count * sizeof(TaskInfo));
+        if (delta == NULL) return -1;
+        ctx->delta = delta;
+        int* delta_index = realloc(ctx->delta_index, (size_t)delta_count * sizeof(int));
+        if (delta_index == NULL) return -1;
+        ctx->delta_index = delta_index;
+        ctx->delta_capacity = delta_count;
+    }
+
+    for (int i = 0; i < delta_count && !rec.error; i++) {
+        int index = snapshot_get_int(&rec, 0, ctx->base_count - 1);
+        ctx->delta_index[i] = index;
+        snapshot_get_task(&rec, &ctx->delta[i]);
+
+        // Sure duzenlemesi: gorev bu kayitta calismaya baslamissa artik etkiler.
+        // Hic baslamadan zaman asimina ugrayan gorev de zamanasimi satirinda kalan
+        // suresini basmistir; etkisi sonlanma anindadir.
+        if (index < ctx->edited_count && ctx->kinds[index] == EDIT_BURST) {
+            const TaskInfo* task = &ctx->delta[i];
+            int effect = INT32_MAX;
+            if (task->start_time >= 0) {
+                effect = task->start_time;
+            } else if (task->state == TASK_STATE_TERMINATED) {
+                effect = task->completion_time;
+            }
+            if (effect != INT32_MAX) {
+                valid = 0;
+                ctx->first_effect = min_int(ctx->first_effect, effect);
+            }
+        }
+    }
+    if (rec.error) return -1;
+    if (!valid) return 0;
+
+    for (int i = 0; i < delta_count; i++) {
+        g_tasks[ctx->delta_index[i]] = ctx->delta[i];
+    }
+    if (snapshot_get_queues(&rec) != 0) return -1;
+    snapshot_get_metrics(&rec);
+    if (rec.error) return -1;
+
+    g_current_time = snap_time;
+    g_completed_tasks = completed;
+    g_context_switches = switches;
+    return 1;
+}
+
+// Duzenlenmis is yukunu secilen kayit durumuna uygula
+static void whatif_apply_edits(const WhatIfContext* ctx, int records_used) {
+    if (records_used == 0) {
+        // Duzenleme ilk kayittan once etkiliyor: bastan calis
+        for (int i = 0; i < ctx->edited_count; i++) {
+            task_init(&g_tasks[i], i, ctx->edited[i].arrival_time,
+                      ctx->edited[i].priority, ctx->edited[i].burst_time);
+        }
+        init_queues();
+        metrics_init();
+        g_current_time = 0;
+        g_completed_tasks = 0;
+        g_context_switches = 0;
+    } else {
+        // Etkilenen gorevler bu kayitta henuz dokunulmamis durumda
+        for (int i = 0; i < ctx->edited_count; i++) {
+            if (ctx->kinds[i] == EDIT_ARRIVAL) {
+                task_init(&g_tasks[i], i, ctx->edited[i].arrival_time,
+                          ctx->edited[i].priority, ctx->edited[i].burst_time);
+            } else if (ctx->kinds[i] == EDIT_BURST) {
+                g_tasks[i].burst_time = ctx->edited[i].burst_time;
+                g_tasks[i].remaining_time = ctx->edited[i].burst_time;
+            }
+        }
+    }
+    g_task_count = ctx->edited_count;  // Silinen gorevler her zaman sondadir
+}
+
+int whatif_prepare(const char* path, int* resumed) {
+    *resumed = 0;
+
+    FILE* file = fopen(path, "rb");
+    if (file == NULL) {
+        printf("[HATA] Kayit gunlugu acilamadi: %s\n", path);
+        return -1;
+    }
+
+    WhatIfContext ctx;
+    memset(&ctx, 0, sizeof(ctx));
+    int result = -1;
+    int edits = 0;
+    int records_used = 0;
+    int records_total = 0;
+
+    // Duzenlenmis is yuku su an g_tasks icinde (giris dosyasindan yuklendi)
+    ctx.edited_count = g_task_count;
+    ctx.edited = malloc((size_t)(ctx.edited_count > 0 ? ctx.edited_count : 1) * sizeof(TaskDefinition));
+    if (ctx.edited != NULL) {
+        for (int i = 0; i < ctx.edited_count; i++) {
+            ctx.edited[i].arrival_time = g_tasks[i].arrival_time;
+            ctx.edited[i].priority = g_tasks[i].original_priority;
+            ctx.edited[i].burst_time = g_tasks[i].burst_time;
+        }
+        result = whatif_read_header(file, &ctx);
+    }
+
+    int total_count = ctx.base_count > ctx.edited_count ? ctx.base_count : ctx.edited_count;
+    if (result == 0) {
+        ctx.kinds = malloc((size_t)(total_count > 0 ? total_count : 1));
+        if (ctx.kinds == NULL || tasks_reserve(total_count) != 0) result = -1;
+    }
+
+    if (result == 0) {
+        edits = whatif_classify(ctx.base, ctx.base_count, ctx.edited, ctx.edited_count,
+                                ctx.kinds, &ctx.limit_time);
+        ctx.first_effect = ctx.limit_time;
+
+        // Temel is yukunun baslangic durumundan kayitlari sirayla uygula;
+        // duzenlemenin etkiledigi ilk kayitta dur (kosullar geri donulmez)
+        for (int i = 0; i < ctx.base_count; i++) {
+            task_init(&g_tasks[i], i, ctx.base[i].arrival_time,
+                      ctx.base[i].priority, ctx.base[i].burst_time);
+        }
+        g_task_count = ctx.base_count;
+        init_queues();
+        metrics_init();
+
+        int searching = 1;
+        int status;
+        while ((status = snaplog_read_frame(file, &ctx.frame)) == 0) {
+            records_total++;
+            if (!searching) continue;  // Sadece toplam kayit sayisi icin
+
+            int applied = whatif_apply_record(&ctx);
+            if (applied < 0) {
+                result = -1;
+                break;
+            }
+            if (applied == 0) {
+                searching = 0;
+            } else {
+                records_used++;
+            }
+        }
+        if (status < 0) result = -1;
+    }
+
+    if (result == 0) {
+        whatif_apply_edits(&ctx, records_used);
+        *resumed = records_used > 0;
+        result = scheduler_rebuild_indexes();
+    }
+
+    if (result != 0) {
+        printf("[HATA] Kayit gunlugu gecersiz veya bozuk: %s\n", path);
+    } else {
+        if (edits == 0) {
+            fprintf(stderr, "[ANALIZ] Is yuku temel calismayla ayni\n");
+        } else if (ctx.first_effect == INT32_MAX) {
+            fprintf(stderr, "[ANALIZ] %d gorev degisti, kayitlar boyunca hicbir seyi etkilemedi\n", edits);
+        } else {
+            fprintf(stderr, "[ANALIZ] %d gorev degisti, ilk etki t=%d\n", edits, ctx.first_effect);
+        }
+        if (records_used > 0) {
+            fprintf(stderr, "[ANALIZ] t=%d kaydindan devam ediliyor (%d/%d kayit)\n",
+                    g_current_time, records_used, records_total);
+        } else {
+            fprintf(stderr, "[ANALIZ] Uygun kayit yok, t=0'dan baslaniyor\n");
+        }
+    }
+
+    fclose(file);
+    whatif_free(&ctx);
+    return result;
+}
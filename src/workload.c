@@ -0,0 +1,258 @@
+// Sentetik is yuku ureteci ve uctan uca olceklenebilirlik testi
+//
+// Uretec tohumlu PRNG ile giris.txt biciminde gorev listesi yazar: varislar Poisson
+// veya patlamali (grup halinde) surecle, oncelikler agirlikli karisimla, sureler
+// agir kuyruklu Pareto dagilimiyla uretilir. Ayni tohum ve ayarlar her zaman ayni
+// dosyayi uretir.
+//
+// Olceklenebilirlik testi 10^3'ten baslayarak gorev sayisini 10 kat artirir; her
+// boyut icin is yukunu gecici dosyaya yazar, simulatoru --fast ile ayri bir surecte
+// calistirir ve olay/sn ile tepe bellek kullanimini (RSS) raporlar.
+
+#define _DEFAULT_SOURCE     // wait4, mkstemp
+
+#include <math.h>
+#include <time.h>
+
+#ifdef __linux__
+#include <sys/resource.h>
+#include <sys/time.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#include "scheduler.h"
+
+#define WORKLOAD_MAX_BURST      50      // Pareto sure ust siniri (sn)
+#define WORKLOAD_GROUP_MEAN     8.0     // Patlamali varista ortalama grup boyutu
+#define WORKLOAD_IO_BUFFER_SIZE (1 << 20)
+#define SCALE_MIN_TASKS         1000
+
+static const char* ARRIVAL_NAMES[] = { "poisson", "bursty" };
+
+// splitmix64: kucuk durumlu, hizli ve tohumdan tekrarlanabilir
+static uint64_t workload_next(uint64_t* state) {
+    uint64_t z = (*state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+// (0, 1] araliginda duzgun dagilimli sayi (log(0) olmamasi icin 0 haric)
+static double workload_uniform(uint64_t* state) {
+    return (double)((workload_next(state) >> 11) + 1) * (1.0 / 9007199254740992.0);
+}
+
+static double workload_exponential(uint64_t* state, double rate) {
+    return -log(workload_uniform(state)) / rate;
+}
+
+static int workload_priority(uint64_t* state, const WorkloadConfig* config) {
+    double total = 0.0;
+    for (int i = 0; i < WORKLOAD_PRIORITY_COUNT; i++) total += config->priority_weights[i];
+
+    double pick = workload_uniform(state) * total;
+    for (int i = 0; i < WORKLOAD_PRIORITY_COUNT - 1; i++) {
+        if (pick <= config->priority_weights[i]) return i;
+        pick -= config->priority_weights[i];
+    }
+    return WORKLOAD_PRIORITY_COUNT - 1;
+}
+
+// Pareto(xm = 1, alpha): cogu gorev kisa, az sayida gorev cok uzun
+static int workload_burst(uint64_t* state, double alpha) {
+    double value = ceil(pow(workload_uniform(state), -1.0 / alpha));
+    if (value > WORKLOAD_MAX_BURST) return WORKLOAD_MAX_BURST;
+    return (int)value;
+}
+
+void workload_default_config(WorkloadConfig* config) {
+    config->task_count = 1000;
+    config->seed = 1;
+    config->arrival = ARRIVAL_POISSON;
+    config->rate = 0.3;         // Ortalama sure ~3 sn: yuk ~%90
+    for (int i = 0; i < WORKLOAD_PRIORITY_COUNT; i++) config->priority_weights[i] = 1.0;
+    config->burst_alpha = 1.5;
+}
+
+int workload_parse_arrival(const char* text, WorkloadConfig* config) {
+    for (int i = 0; i < (int)(sizeof(ARRIVAL_NAMES) / sizeof(ARRIVAL_NAMES[0])); i++) {
+        if (strcmp(text, ARRIVAL_NAMES[i]) == 0) {
+            config->arrival = (ArrivalProcess)i;
+            return 0;
+        }
+    }
+    return -1;
+}
+
+// "w0,w1,w2,w3" bicimindeki oncelik agirliklari
+int workload_parse_mix(const char* text, WorkloadConfig* config) {
+    double weights[WORKLOAD_PRIORITY_COUNT];
+    double total = 0.0;
+    const char* p = text;
+    for (int i = 0; i < WORKLOAD_PRIORITY_COUNT; i++) {
+        char* end;
+        weights[i] = strtod(p, &end);
+        if (end == p || weights[i] < 0.0) return -1;
+        total += weights[i];
+        p = end;
+        if (i < WORKLOAD_PRIORITY_COUNT - 1) {
+            if (*p != ',') return -1;
+            p++;
+        }
+    }
+    if (*p != '\0' || total <= 0.0) return -1;
+    memcpy(config->priority_weights, weights, sizeof(weights));
+    return 0;
+}
+
+int workload_write(const WorkloadConfig* config, FILE* out) {
+    if (config->task_count < 0 || config->rate <= 0.0 || config->burst_alpha <= 0.0) return -1;
+
+    uint64_t state = config->seed;
+    double clock = 0.0;
+    int group_left = 0;     // Patlamali surecte ayni saniyede gelecek kalan gorev
+
+    for (int i = 0; i < config->task_count; i++) {
+        if (config->arrival == ARRIVAL_POISSON) {
+            clock += workload_exponential(&state, config->rate);
+        } else if (group_left == 0) {
+            // Gruplar seyrek gelir; ortalama varis hizi yine config->rate olur
+            clock += workload_exponential(&state, config->rate / WORKLOAD_GROUP_MEAN);
+            group_left = 1 + (int)floor(log(workload_uniform(&state)) / log(1.0 - 1.0 / WORKLOAD_GROUP_MEAN));
+        }
+        if (group_left > 0) group_left--;
+
+        int arrival = (int)clock;
+        int priority = workload_priority(&state, config);
+        int burst = workload_burst(&state, config->burst_alpha);
+        if (fprintf(out, "%d, %d, %d\n", arrival, priority, burst) < 0) return -1;
+    }
+    return 0;
+}
+
+int workload_generate_file(const WorkloadConfig* config, const char* path) {
+    FILE* file = fopen(path, "w");
+    if (file == NULL) {
+        printf("[HATA] Dosya olusturulamadi: %s\n", path);
+        return -1;
+    }
+    char* buffer = malloc(WORKLOAD_IO_BUFFER_SIZE);
+    if (buffer != NULL) setvbuf(file, buffer, _IOFBF, WORKLOAD_IO_BUFFER_SIZE);
+
+    int result = workload_write(config, file);
+    if (fclose(file) != 0) result = -1;
+    free(buffer);
+    if (result != 0) {
+        printf("[HATA] Is yuku yazilamadi: %s\n", path);
+    }
+    return result;
+}
+
+#ifdef __linux__
+
+static double scale_now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+// Simulatoru ayri surecte calistir; durum satirlarini say ve tepe RSS'i olc
+static int scale_run_once(const char* input_path, long long* events, double* seconds, long* peak_rss_kb) {
+    int fds[2];
+    if (pipe(fds) != 0) return -1;
+
+    double start = scale_now_sec();
+    pid_t pid = fork();
+    if (pid < 0) {
+        close(fds[0]);
+        close(fds[1]);
+        return -1;
+    }
+    if (pid == 0) {
+        dup2(fds[1], STDOUT_FILENO);
+        close(fds[0]);
+        close(fds[1]);
+        execl("/proc/self/exe", "freertos_sim", input_path, "--fast", (char*)NULL);
+        _exit(127);
+    }
+    close(fds[1]);
+
+    // Durum satirlari renk koduyla (ESC) baslar; rapor satirlari baslamaz
+    static char buffer[1 << 16];
+    long long count = 0;
+    int at_line_start = 1;
+    ssize_t n;
+    while ((n = read(fds[0], buffer, sizeof(buffer))) > 0) {
+        for (ssize_t i = 0; i < n; i++) {
+            if (at_line_start && buffer[i] == '\033') count++;
+            at_line_start = (buffer[i] == '\n');
+        }
+    }
+    close(fds[0]);
+
+    int status;
+    struct rusage usage;
+    if (wait4(pid, &status, 0, &usage) != pid) return -1;
+    *seconds = scale_now_sec() - start;
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) return -1;
+
+    *events = count;
+    *peak_rss_kb = usage.ru_maxrss;     // Linux'ta KB
+    return 0;
+}
+
+int workload_scale_benchmark(const WorkloadConfig* config, int max_tasks) {
+    printf("\n=============== Olceklenebilirlik Testi ===============\n");
+    printf("Is yuku: %s, oran %.2f gorev/sn, tohum %llu, pareto alfa %.2f\n",
+           ARRIVAL_NAMES[config->arrival], config->rate,
+           (unsigned long long)config->seed, config->burst_alpha);
+    printf("%10s %12s %9s %12s %10s\n", "gorev", "olay", "sure(sn)", "olay/sn", "tepe RSS(MB)");
+    fflush(stdout);
+
+    char path[] = "/tmp/freertos_sim_workload_XXXXXX";
+    int fd = mkstemp(path);
+    if (fd < 0) {
+        printf("[HATA] Gecici dosya olusturulamadi\n");
+        return -1;
+    }
+    close(fd);
+
+    int result = 0;
+    for (long long tasks = SCALE_MIN_TASKS; tasks <= max_tasks; tasks *= 10) {
+        WorkloadConfig run_config = *config;
+        run_config.task_count = (int)tasks;
+        if (workload_generate_file(&run_config, path) != 0) {
+            result = -1;
+            break;
+        }
+
+        long long events = 0;
+        double seconds = 0.0;
+        long peak_rss_kb = 0;
+        if (scale_run_once(path, &events, &seconds, &peak_rss_kb) != 0) {
+            printf("[HATA] Simulasyon calistirilamadi (%lld gorev)\n", tasks);
+            result = -1;
+            break;
+        }
+        printf("%10lld %12lld %9.3f %12.0f %10.1f\n",
+               tasks, events, seconds, seconds > 0.0 ? events / seconds : 0.0,
+               peak_rss_kb / 1024.0);
+        fflush(stdout);
+    }
+
+    remove(path);
+    return result;
+}
+
+#else
+
+int workload_scale_benchmark(const WorkloadConfig* config, int max_tasks) {
+    (void)config;
+    (void)max_tasks;
+    printf("[HATA] Olceklenebilirlik testi sadece Linux'ta desteklenir\n");
+    return -1;
+}
+
+#endif